@@ -0,0 +1,58 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "pathlab/core/types.hpp"
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/ll/dijkstra.hpp"
+#include "pathlab/ll/engine.hpp"
+
+namespace pathlab {
+
+class JumpTable;
+class LandmarkTable;
+class ScenReader;
+
+struct BatchQuery {
+  NodeId s = 0;
+  NodeId g = 0;
+};
+
+struct BatchOptions {
+  unsigned    threads    = 1;
+  std::string pq         = "heap";
+  uint32_t    stoc_block = 0;   // 0 = 정렬 커널별 기본 (STOCPQ::default_block_size)
+  Engine      engine     = Engine::AStar;
+  const JumpTable* jt    = nullptr;   // Engine::JPSPlus 용
+  const LandmarkTable* lt = nullptr;  // Engine::ALT 용
+  uint32_t    chunk      = 8;         // 작업 단위(쿼리 수)
+};
+
+struct BatchThreadStats {
+  uint64_t queries = 0;
+  uint64_t steals  = 0;     // 다른 워커에서 훔쳐 온 chunk 수
+  double   busy_ms = 0.0;   // 쿼리 실행에 쓴 시간
+  DijkstraMetrics algo;
+  PQMetrics pq;
+};
+
+struct BatchReport {
+  std::vector<Cost32> dist;               // 쿼리 순서대로 dist(g)
+  std::vector<BatchThreadStats> threads;
+  double wall_ms = 0.0;
+  double qps     = 0.0;
+};
+
+// GridMap 은 읽기 전용으로 공유, 워커마다 큐/워크스페이스를 따로 둠
+// 작업은 chunk 단위로 워커별 deque 에 나눠 두고, 빈 워커는 다른 워커의
+// 뒤쪽 절반을 훔쳐 온다 (경로 길이에 따라 쿼리 비용이 크게 다름)
+BatchReport run_batch(const GridMap& G, const std::vector<BatchQuery>& queries,
+                      const BatchOptions& opt);
+
+// 스트리밍: 호출 스레드가 reader 에서 batch 개씩 파싱해 공유 큐에 넣고,
+// 워커(opt.threads 개)는 파일을 다 읽기 전부터 opt.chunk 단위로 가져가 풂
+// (케이스 좌표는 G 의 폭으로 NodeId 변환, 결과 dist 는 파일 순서)
+BatchReport run_batch_stream(const GridMap& G, ScenReader& reader,
+                             const BatchOptions& opt, std::size_t batch = 4096);
+
+} // namespace pathlab
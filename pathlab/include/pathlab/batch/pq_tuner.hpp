@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/io/scen_loader.hpp"
+#include "pathlab/ll/engine.hpp"
+#include "pathlab/batch/batch_runner.hpp"
+
+namespace pathlab {
+
+struct TuneCandidate {
+  std::string pq;
+  uint32_t    stoc_block = 0;   // stoc* 에서만 사용
+};
+
+struct TuneOptions {
+  Engine   engine = Engine::AStar;
+  uint32_t reps   = 5;          // 후보마다 표본 전체를 도는 횟수 (중앙값 사용)
+  uint32_t warmup = 1;
+  double   prune  = 4.0;        // 첫 회에 최고보다 이 배수 넘게 느린 후보는 이후 반복 생략 (0 = 끔)
+  std::vector<TuneCandidate> candidates;   // 비면 default_tune_candidates()
+  const JumpTable*     jt = nullptr;
+  const LandmarkTable* lt = nullptr;
+};
+
+struct TuneResult {
+  TuneCandidate c;
+  double median_ns = 0.0;      // 표본 전체 1회의 시간 (reps 중앙값)
+  double min_ns    = 0.0;
+  double ns_per_query = 0.0;
+  bool   dist_ok = true;       // heap 결과와 dist 가 모두 같은지 (중간에 끊긴 후보는 돈 쿼리까지)
+  bool   pruned  = false;      // 첫 회 시간만 측정 (median/min 은 그 값)
+};
+
+// heap, d-ary/lazy, radix, bucket, stoc × blocks, stoc_radix/stoc_net (커널 기본 블록)
+std::vector<TuneCandidate> default_tune_candidates(
+    const std::vector<uint32_t>& blocks = {64, 128, 256, 512, 1024});
+
+// scen 에서 n 개를 균등 간격으로 뽑음 (scen 은 경로 길이 bucket 순이라 길이 분포가 유지됨)
+std::vector<BatchQuery> sample_queries(const GridMap& G, const std::vector<ScenCase>& S,
+                                       uint32_t n);
+
+// 후보마다 같은 쿼리 표본을 돌려 시간 측정, 빠른 순으로 반환 (dist 가 다른 후보는 맨 뒤)
+// 반복마다 후보를 번갈아 돌려 측정 중 클럭/캐시 변화가 한 후보에 몰리지 않게 함
+std::vector<TuneResult> tune_pq(const GridMap& G, const std::vector<BatchQuery>& Q,
+                                const TuneOptions& opt);
+
+} // namespace pathlab
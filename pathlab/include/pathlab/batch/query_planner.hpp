@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "pathlab/core/types.hpp"
+#include "pathlab/core/graph_iface.hpp"
+#include "pathlab/queues/ipq.hpp"
+#include "pathlab/ll/dijkstra.hpp"
+#include "pathlab/ll/workspace.hpp"
+#include "pathlab/batch/batch_runner.hpp"
+
+namespace pathlab {
+
+struct PlannerOptions {
+  std::string pq         = "heap";
+  uint32_t    stoc_block = 0;   // 0 = 정렬 커널별 기본 (STOCPQ::default_block_size)
+  uint32_t    bucket_w   = 0;     // 0 = 그래프 최대 간선 코스트 (GridMap 이면 14)
+  std::size_t cache_trees = 0;    // 최근 출발점 거리 트리 LRU 용량 (0 = 캐시 없음)
+};
+
+struct PlannerStats {
+  uint64_t queries    = 0;
+  uint64_t sources    = 0;   // 서로 다른 출발점 그룹 수
+  uint64_t searches   = 0;   // 실제로 돌린 dijkstra_multi 수
+  uint64_t cache_hits = 0;   // 탐색 없이 캐시 트리로 답한 그룹 수
+  DijkstraMetrics algo;
+  PQMetrics pq;
+};
+
+// 출발점별로 쿼리를 묶어 그룹마다 Dijkstra 한 번 (그룹의 goal 이 모두 settle 되면 멈춤)
+// - 조기 종료한 트리는 radius(마지막 pop 키) 이하 dist 만 확정 → 캐시 조회 시
+//   dist(g) <= radius 인 goal 만 캐시로 답하고, 나머지가 있으면 다시 탐색해 교체
+// - 큐/워크스페이스/캐시를 가지므로 스레드마다 하나씩
+class QueryPlanner {
+public:
+  QueryPlanner(const IGraph& G, const PlannerOptions& opt);
+
+  // 쿼리 순서대로 dist(g)
+  std::vector<Cost32> solve(const std::vector<BatchQuery>& queries);
+  // 한 출발점에서 goals 전부 (out[i] = dist(goals[i]))
+  void one_to_many(NodeId s, const NodeId* goals, std::size_t n, Cost32* out);
+
+  const PlannerStats& stats() const { return st_; }
+  void reset_stats() { st_ = {}; }
+  std::size_t cached_trees() const { return lru_.size(); }
+  void clear_cache() { lru_.clear(); index_.clear(); }
+
+private:
+  struct Tree {
+    NodeId s;
+    Cost32 radius;             // dist <= radius 인 노드는 확정
+    std::vector<Cost32> dist;  // N 개
+  };
+
+  Tree* lookup_(NodeId s);     // 있으면 LRU 맨 앞으로
+  void store_(NodeId s, Cost32 radius);
+
+  const IGraph& G_;
+  PlannerOptions opt_;
+  std::unique_ptr<IPQ> Q_;
+  SearchWorkspace ws_;
+  std::list<Tree> lru_;        // 앞이 최근
+  std::unordered_map<NodeId, std::list<Tree>::iterator> index_;
+  std::vector<NodeId> miss_;   // 캐시로 답하지 못한 goal (재사용 버퍼)
+  PlannerStats st_;
+};
+
+} // namespace pathlab
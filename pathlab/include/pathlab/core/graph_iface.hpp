@@ -10,6 +10,11 @@ public:
   virtual ~IGraph() = default;
   virtual std::size_t num_nodes() const = 0;
   virtual void for_each_edge(NodeId u, EdgeCB cb, void* ctx) const = 0;
+  // 최대 간선 코스트 (BucketPQ 폭). 기본 구현은 간선 전체 스캔
+  virtual Cost32 max_edge_cost() const;
 };
 
+// 노드 수 + 간선 목록 전체의 FNV-1a (전처리 캐시가 같은 그래프에서 만들어졌는지 확인)
+uint64_t graph_hash(const IGraph& G);
+
 } // namespace pathlab
@@ -7,27 +7,78 @@
 namespace pathlab {
 
 // MovingAI .map -> 4/8-이웃 그래프 (정수 코스트: 직선10, 대각14)
+// 로드 시 셀별 8비트 이웃 마스크(bit i = 방향 i 로 이동 가능)와
+// 비트 패킹 통행 평면을 만들어, 확장 시 좌표 복원/경계 검사를 하지 않음
+//
+// 바이너리 맵(.gmap, save_binary 로 생성)은 mmap 으로 열어 통행 평면/마스크를
+// 복사 없이 그대로 가리킴 (같은 맵을 여는 프로세스끼리 페이지 공유)
+// - 생성자는 파일 앞 magic 으로 .map / .gmap 을 자동 구분
+// - 마스크는 항상 8방향 기준으로 보관하고 allow_diag=0 이면 직선 비트만 사용
 class GridMap final : public IGraph {
 public:
   explicit GridMap(const std::string& map_path, bool allow_diag = true);
+  ~GridMap() override;
+  GridMap(GridMap&& o) noexcept;
+  GridMap& operator=(GridMap&& o) noexcept;
+  GridMap(const GridMap&) = delete;
+  GridMap& operator=(const GridMap&) = delete;
+
+  // .gmap 저장 (with_masks=0 이면 통행 평면만, 로드 시 마스크를 다시 계산)
+  bool save_binary(const std::string& path, bool with_masks = true) const;
+  bool mapped() const { return map_ != nullptr; }
 
   std::size_t num_nodes() const override { return (std::size_t)W_ * (std::size_t)H_; }
 
   // ★ 여기: IGraph::EdgeCB 로 명시
   void for_each_edge(NodeId u, IGraph::EdgeCB cb, void* ctx) const override;
 
+  // 템플릿 커널용: f(v, w) 를 인라인 호출 (간접 호출 없음)
+  // 마스크의 set 비트만 순회 → 분기/경계 검사 없음
+  template <class F>
+  void for_each_neighbor(NodeId u, F&& f) const {
+    uint32_t m = nbr_[u] & dir_mask_;
+    while (m) {
+      const int i = __builtin_ctz(m);
+      m &= m - 1;
+      f((NodeId)((int64_t)u + off_[i]), kW8[i]);
+    }
+  }
+
   int width()  const { return W_; }
   int height() const { return H_; }
+  bool allow_diag() const { return diag_; }
+  Cost32 max_edge_cost() const override { return diag_ ? kW8[4] : kW8[0]; }
   bool passable(int x, int y) const {
     if (x < 0 || y < 0 || x >= W_ || y >= H_) return false;
-    return free_[y*W_ + x];
+    const std::size_t i = (std::size_t)y*W_ + x;
+    return (bits_[i >> 6] >> (i & 63)) & 1u;
   }
+  uint8_t neighbor_mask(NodeId u) const { return (uint8_t)(nbr_[u] & dir_mask_); }
   static inline NodeId id(int x, int y, int W) { return (NodeId)(y*W + x); }
 
+  // 방향 i (0..3 직선, 4..7 대각) — 이웃 마스크 비트 순서와 동일
+  static constexpr int kDx8[8] = { 1,-1, 0, 0, 1, 1,-1,-1 };
+  static constexpr int kDy8[8] = { 0, 0, 1,-1, 1,-1, 1,-1 };
+  static constexpr Cost32 kW8[8] = {10,10,10,10,14,14,14,14};
+
 private:
   int W_ = 0, H_ = 0;
   bool diag_ = true;
-  std::vector<uint8_t> free_;
+  uint32_t dir_mask_ = 0xff;       // allow_diag=0 이면 0x0f
+  const uint64_t* bits_ = nullptr; // 통행 가능 비트 평면 (셀당 1bit)
+  const uint8_t*  nbr_  = nullptr; // 셀별 8방향 이웃 마스크 (막힌 셀은 0)
+  int32_t off_[8] = {};            // 방향별 NodeId 오프셋 (dy*W + dx)
+
+  // .map 파싱 / 마스크 없는 .gmap 용 소유 버퍼
+  std::vector<uint64_t> bits_store_;
+  std::vector<uint8_t>  nbr_store_;
+  void*       map_ = nullptr;      // .gmap 매핑
+  std::size_t map_len_ = 0;
+
+  void load_text_(const std::string& map_path);
+  bool load_binary_(const std::string& map_path);
+  void build_neighbor_masks_();
+  void unmap_();
 };
 
 } // namespace pathlab
@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "pathlab/ll/dijkstra.hpp"
+#include "pathlab/util/counters.hpp"
+#include "pathlab/util/perf_counters.hpp"
+
+namespace pathlab {
+
+// bench_single 결과 파일 (CSV / JSON)
+// 시간은 케이스별 반복(reps) 표본의 요약 통계, 단위 ns
+struct BenchCase {
+  int id = 0;
+  int sx = 0, sy = 0, gx = 0, gy = 0;
+  uint32_t dist = 0, steps = 0;
+  uint32_t reps = 0;
+  double min_ns = 0.0, median_ns = 0.0, mean_ns = 0.0, stddev_ns = 0.0;
+  double p90_ns = 0.0, max_ns = 0.0;
+  PQMetrics pq;
+  DijkstraMetrics algo;
+  HwCounts hw;   // --perf 일 때만 (반복 평균)
+};
+
+struct BenchRun {
+  std::string map, scen, pq, engine;
+  uint32_t reps = 1, warmup = 0;
+  bool has_hw = false;
+  std::vector<BenchCase> cases;
+};
+
+// 실패 시 false
+bool write_bench_csv(const std::string& path, const BenchRun& R);
+bool write_bench_json(const std::string& path, const BenchRun& R);
+
+// write_bench_csv 형식만 읽음 (열 이름으로 매칭, '#' 줄은 메타). 실패 시 예외
+BenchRun load_bench_csv(const std::string& path);
+
+// 두 결과 비교: 케이스별 Welch t-검정 + 전체는 케이스 중앙값 로그비의 Wilcoxon 부호 순위 검정
+struct CompareOptions {
+  double alpha     = 0.01;   // 유의 수준
+  double threshold = 0.05;   // 이 비율 이상 느려져야 회귀로 봄
+};
+
+struct CaseDelta {
+  int id = 0;
+  double base_ns = 0.0, cand_ns = 0.0;   // 중앙값
+  double ratio = 1.0;                    // cand / base
+  double p = 1.0;
+  bool regression = false, improvement = false;
+  bool dist_mismatch = false;
+};
+
+struct CompareResult {
+  std::vector<CaseDelta> cases;          // 공통 케이스 (id 순)
+  std::size_t regressions = 0, improvements = 0, dist_mismatches = 0;
+  double geomean_ratio = 1.0;            // cand / base 중앙값 비의 기하평균
+  double z = 0.0, p = 1.0;               // Wilcoxon
+  bool regression = false;               // 전체 판정
+  std::string error;                     // 비교 불가 사유 (케이스 불일치 등)
+};
+
+CompareResult compare_bench(const BenchRun& base, const BenchRun& cand,
+                            const CompareOptions& opt = {});
+
+} // namespace pathlab
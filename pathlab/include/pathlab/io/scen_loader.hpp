@@ -1,5 +1,7 @@
 #pragma once
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include "pathlab/core/types.hpp"
 
@@ -13,6 +15,62 @@ struct ScenCase {
   double opt = 0.0;
 };
 
+// 스트리밍용 케이스: 맵 이름은 ScenReader 의 intern 테이블 id
+struct ScenRecord {
+  uint32_t bucket = 0;
+  uint32_t map_id = 0;
+  int map_w = 0, map_h = 0;
+  int sx = 0, sy = 0;
+  int gx = 0, gy = 0;
+  double opt = 0.0;
+};
+
+// .scen 스트리밍 리더
+// - 파일을 mmap 하고 std::from_chars 로 한 줄씩 파싱 (줄 단위 문자열 복사 없음)
+// - 맵 이름은 매핑 안을 가리키는 string_view 로 intern (리더가 살아 있는 동안 유효)
+// - next() / for_each_batch() 로 고정 크기 배치를 넘김 → 전체 파싱 전에 소비 시작 가능
+// 형식이 깨진 줄은 load_scen 과 같이 건너뜀
+class ScenReader {
+public:
+  explicit ScenReader(const std::string& scen_path);
+  ~ScenReader();
+  ScenReader(const ScenReader&) = delete;
+  ScenReader& operator=(const ScenReader&) = delete;
+
+  // out 을 비우고 최대 max 개를 채움 (더 없으면 false)
+  bool next(std::vector<ScenRecord>& out, std::size_t max);
+
+  // f(const ScenRecord* recs, std::size_t n) 를 배치마다 호출, 총 케이스 수 반환
+  template <class F>
+  std::size_t for_each_batch(std::size_t batch, F&& f) {
+    std::vector<ScenRecord> buf;
+    buf.reserve(batch);
+    std::size_t total = 0;
+    while (next(buf, batch)) {
+      f(buf.data(), buf.size());
+      total += buf.size();
+    }
+    return total;
+  }
+
+  void rewind();
+  std::size_t num_maps() const { return names_.size(); }
+  std::string_view map_name(uint32_t id) const { return names_[id]; }
+
+private:
+  bool parse_line_(const char* b, const char* e, ScenRecord& r);
+  uint32_t intern_(std::string_view name);
+
+  void*       map_ = nullptr;
+  std::size_t len_ = 0;
+  const char* begin_ = nullptr;
+  const char* cur_ = nullptr;
+  const char* end_ = nullptr;
+  std::vector<std::string_view> names_;
+  std::unordered_map<std::string_view, uint32_t> ids_;
+};
+
+// 전체를 벡터로 (ScenReader 위에 구현)
 std::vector<ScenCase> load_scen(const std::string& scen_path);
 inline NodeId node_from_xy(int x, int y, int W) { return (NodeId)(y*W + x); }
 
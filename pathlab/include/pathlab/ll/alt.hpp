@@ -0,0 +1,90 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "pathlab/core/types.hpp"
+#include "pathlab/core/graph_iface.hpp"
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/queues/ipq.hpp"
+#include "pathlab/ll/dijkstra.hpp"
+#include "pathlab/ll/workspace.hpp"
+
+namespace pathlab {
+
+// landmark 선택 전략
+enum class LandmarkSelect {
+  Farthest,   // 기존 landmark 들로부터 최소 거리가 가장 먼 노드
+  Avoid,      // Goldberg-Werneck avoid: 하한이 나쁜 부분 트리의 잎
+};
+
+bool parse_landmark_select(const std::string& name, LandmarkSelect& out);
+const char* landmark_select_name(LandmarkSelect s);
+
+struct ALTBuildStats {
+  double   select_ms = 0.0;   // landmark 선택 (순차)
+  double   table_ms  = 0.0;   // 거리 테이블 생성 (병렬)
+  unsigned threads   = 0;
+};
+
+// ALT 거리 테이블: 노드 × K (노드별 K 개가 연속 → h() 한 번에 캐시 라인 1~2개)
+// - 파일을 mmap 해서 읽기 전용으로 공유 (쿼리당 메모리는 워크스페이스뿐)
+// - 대칭 그래프 전용: d(L, v) = d(v, L)
+// - 도달 불가 항목은 INF (h 계산에서 제외)
+class LandmarkTable {
+public:
+  LandmarkTable() = default;
+  ~LandmarkTable();
+  LandmarkTable(LandmarkTable&& o) noexcept;
+  LandmarkTable& operator=(LandmarkTable&& o) noexcept;
+  LandmarkTable(const LandmarkTable&) = delete;
+  LandmarkTable& operator=(const LandmarkTable&) = delete;
+
+  // path 가 비어 있지 않고 쓸 수 있으면 파일로 만들어 매핑, 아니면 익명 매핑
+  static LandmarkTable build(const IGraph& G, uint32_t K, LandmarkSelect sel,
+                             unsigned threads = 0, const std::string& path = "",
+                             ALTBuildStats* st = nullptr);
+
+  // <map_path>.alt: 노드 수/간선 해시/K/전략이 맞으면 mmap, 아니면 build 후 저장
+  static LandmarkTable load_or_build(const IGraph& G, const std::string& map_path,
+                                     uint32_t K, LandmarkSelect sel, unsigned threads = 0,
+                                     bool* loaded = nullptr, ALTBuildStats* st = nullptr);
+  bool open(const std::string& path, const IGraph& G, uint32_t K, LandmarkSelect sel);
+
+  static std::string cache_path(const std::string& map_path) { return map_path + ".alt"; }
+
+  bool empty() const { return data_ == nullptr; }
+  uint32_t num_landmarks() const { return K_; }
+  NodeId landmark(uint32_t i) const { return landmarks_[i]; }
+  const Cost32* row(NodeId v) const { return data_ + (std::size_t)v * K_; }
+
+  // max_i |d(L_i, v) - d(L_i, g)|  (gr = row(g))
+  Cost32 h(NodeId v, const Cost32* gr) const {
+    const Cost32* vr = row(v);
+    Cost32 best = 0;
+    for (uint32_t i = 0; i < K_; ++i) {
+      const Cost32 a = vr[i], b = gr[i];
+      if (a == Key::INF || b == Key::INF) continue;
+      const Cost32 d = (a > b) ? a - b : b - a;
+      if (d > best) best = d;
+    }
+    return best;
+  }
+
+private:
+  void unmap_();
+
+  void*       map_ = nullptr;
+  std::size_t map_len_ = 0;
+  const Cost32* data_ = nullptr;
+  uint32_t K_ = 0;
+  std::vector<NodeId> landmarks_;
+};
+
+// A* + ALT: h = max(octile, landmark 하한) (둘 다 consistent 이므로 max 도 consistent)
+// 키/종료 조건은 astar_single 과 동일
+SearchView alt_single(const GridMap& G, NodeId s, NodeId g, IPQ& Q,
+                      SearchWorkspace& ws, const LandmarkTable& L);
+DijkstraResult alt_single(const GridMap& G, NodeId s, NodeId g, IPQ& Q,
+                          const LandmarkTable& L);
+
+} // namespace pathlab
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdlib>
+#include "pathlab/core/types.hpp"
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/queues/ipq.hpp"
+#include "pathlab/ll/dijkstra.hpp"
+
+namespace pathlab {
+
+// GridMap 코스트(직선10, 대각14)와 일치하는 octile 휴리스틱 (4-이웃이면 맨해튼)
+inline Cost32 octile_h(int x0, int y0, int x1, int y1, bool allow_diag) {
+  const Cost32 dx = (Cost32)std::abs(x1 - x0);
+  const Cost32 dy = (Cost32)std::abs(y1 - y0);
+  if (!allow_diag) return 10u * (dx + dy);
+  return (dx > dy) ? 10u * dx + 4u * dy : 10u * dy + 4u * dx;
+}
+
+// 목표 지향 A*: Key.primary = f = g + h, Key.tie = h (h 작은 쪽 우선)
+// - 정렬 큐(Q.ordered())는 goal 이 settle 되는 즉시 종료
+// - 비정렬 큐(STOCPQ 등)는 f >= dist[g] 가지치기로 큐를 소진할 때까지 진행
+// dist/parent 는 탐색이 닿은 노드만 유효 (나머지는 INF / INVALID)
+SearchView astar_single(const GridMap& G, NodeId s, NodeId g, IPQ& Q,
+                        SearchWorkspace& ws);
+DijkstraResult astar_single(const GridMap& G, NodeId s, NodeId g, IPQ& Q);
+
+} // namespace pathlab
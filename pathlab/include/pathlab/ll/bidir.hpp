@@ -0,0 +1,33 @@
+#pragma once
+#include <vector>
+#include "pathlab/core/types.hpp"
+#include "pathlab/core/graph_iface.hpp"
+#include "pathlab/queues/ipq.hpp"
+#include "pathlab/ll/dijkstra.hpp"
+#include "pathlab/ll/workspace.hpp"
+
+namespace pathlab {
+
+// 양방향 Dijkstra 결과: 두 워크스페이스를 들여다봄 (다음 쿼리 시작 시 무효)
+struct BidirView {
+  const SearchWorkspace* fwd = nullptr;
+  const SearchWorkspace* bwd = nullptr;
+  NodeId meet = SearchWorkspace::INVALID;  // mu 를 만든 노드 (도달 불가면 INVALID)
+  Cost32 dist = Key::INF;                  // mu = d_f(meet) + d_b(meet)
+  DijkstraMetrics algo;                    // 양방향 합
+  PQMetrics pq;                            // 양방향 합
+  DijkstraMetrics algo_fwd, algo_bwd;
+
+  // s .. meet .. g (도달 불가면 빈 벡터)
+  std::vector<NodeId> path() const;
+};
+
+// 대칭 그래프(GridMap 등) 전용: 역방향 탐색도 같은 G 를 사용
+// - 매 단계 top 키가 작은 쪽을 확장
+// - 정렬 큐: top_f + top_b >= mu 이면 종료 (표준 mu-bound)
+// - 비정렬 큐(STOCPQ): d(u) >= mu 인 노드는 확장하지 않고 양쪽이 빌 때까지 진행
+BidirView bidir_single(const IGraph& G, NodeId s, NodeId g,
+                       IPQ& Qf, IPQ& Qb,
+                       SearchWorkspace& wf, SearchWorkspace& wb);
+
+} // namespace pathlab
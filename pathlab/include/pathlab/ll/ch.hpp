@@ -0,0 +1,74 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "pathlab/core/types.hpp"
+#include "pathlab/core/graph_iface.hpp"
+#include "pathlab/queues/ipq.hpp"
+#include "pathlab/ll/workspace.hpp"
+#include "pathlab/ll/bidir.hpp"
+
+namespace pathlab {
+
+struct CHBuildStats {
+  uint32_t rounds    = 0;   // 독립 집합 축약 라운드 수
+  uint64_t shortcuts = 0;
+  uint64_t witness_settled = 0;
+  unsigned threads   = 0;
+  double   ms        = 0.0;
+};
+
+// Contraction Hierarchy (대칭 그래프 전용: GridMap 등)
+// - 노드 순서(rank) + 각 노드의 "위쪽" 간선(rank 가 더 높은 이웃, shortcut 포함)만 CSR 로 보관
+// - 대칭이므로 정/역방향 탐색이 같은 위쪽 간선을 사용
+// - shortcut 의 mid 는 축약된 가운데 노드 (원래 간선은 INVALID)
+class CHGraph {
+public:
+  struct Edge {
+    NodeId to;
+    Cost32 w;
+    NodeId mid;
+  };
+
+  CHGraph() = default;
+
+  // threads == 0 → hardware_concurrency
+  static CHGraph build(const IGraph& G, unsigned threads = 0, CHBuildStats* st = nullptr);
+
+  // <map_path>.ch 캐시: 노드 수/간선 해시가 맞으면 로드, 아니면 build 후 저장 시도
+  static CHGraph load_or_build(const IGraph& G, const std::string& map_path,
+                               unsigned threads = 0, bool* loaded = nullptr,
+                               CHBuildStats* st = nullptr);
+  bool save(const std::string& path) const;
+  bool load(const std::string& path, const IGraph& G);
+
+  static std::string cache_path(const std::string& map_path) { return map_path + ".ch"; }
+
+  bool empty() const { return first_.empty(); }
+  std::size_t num_nodes() const { return rank_.size(); }
+  std::size_t num_edges() const { return edges_.size(); }
+  uint32_t rank(NodeId u) const { return rank_[u]; }
+  const Edge* up_begin(NodeId u) const { return edges_.data() + first_[u]; }
+  const Edge* up_end(NodeId u) const { return edges_.data() + first_[u + 1]; }
+
+  // CH 경로(shortcut 포함) → 원래 그래프의 노드 경로
+  std::vector<NodeId> unpack(const std::vector<NodeId>& path) const;
+
+private:
+  void unpack_edge_(NodeId a, NodeId b, std::vector<NodeId>& out) const;
+
+  uint64_t hash_ = 0;
+  std::vector<uint32_t> rank_;
+  std::vector<uint32_t> first_;   // N+1
+  std::vector<Edge> edges_;
+};
+
+// 양방향 위쪽 탐색 (stall-on-demand)
+// - 정렬 큐: 한쪽 top >= mu 이면 그쪽 종료
+// - 비정렬 큐(STOCPQ): d(u) >= mu 인 노드는 확장하지 않고 양쪽이 빌 때까지 진행
+// 결과의 path() 는 shortcut 을 포함하므로 원래 경로는 H.unpack(V.path())
+BidirView ch_query(const CHGraph& H, NodeId s, NodeId g,
+                   IPQ& Qf, IPQ& Qb,
+                   SearchWorkspace& wf, SearchWorkspace& wb);
+
+} // namespace pathlab
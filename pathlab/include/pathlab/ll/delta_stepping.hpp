@@ -0,0 +1,23 @@
+#pragma once
+#include "pathlab/core/types.hpp"
+#include "pathlab/core/graph_iface.hpp"
+#include "pathlab/ll/dijkstra.hpp"
+
+namespace pathlab {
+
+struct DeltaOptions {
+  // 버킷 폭 (10/14 가중치 기준)
+  // - 10: 직선 간선만 light, 14: 모든 간선 light, 28 이상: 버킷당 여러 "링"
+  Cost32   delta   = 14;
+  unsigned threads = 0;    // 0 = hardware_concurrency
+};
+
+// 병렬 delta-stepping 전체 SSSP (Meyer & Sanders)
+// - 버킷 i 의 frontier 에서 light 간선(w <= delta)을 버킷이 빌 때까지 반복 완화
+// - 그 뒤 버킷 i 에서 settle 된 노드들의 heavy 간선(w > delta)을 한 번 완화
+// - 각 단계의 완화는 스레드 간 분할, 노드별 (dist, parent) 를 64비트 하나로 묶어 CAS
+// 결과는 dijkstra_single 과 같은 DijkstraResult (dist 는 동일, parent 는 동률 경로에서 다를 수 있음)
+// pq 메트릭: pushes = 버킷 삽입, pops = frontier 처리 노드, scans = 단계(phase) 수
+DijkstraResult delta_stepping(const IGraph& G, NodeId s, const DeltaOptions& opt = {});
+
+} // namespace pathlab
@@ -3,15 +3,11 @@
 #include "pathlab/core/types.hpp"
 #include "pathlab/core/graph_iface.hpp"
 #include "pathlab/queues/ipq.hpp"
+#include "pathlab/ll/workspace.hpp"
+#include "pathlab/util/metrics_policy.hpp"
 
 namespace pathlab {
 
-struct DijkstraMetrics {
-  uint64_t relaxations = 0;
-  uint64_t improved    = 0;
-  uint64_t settled     = 0;
-};
-
 struct DijkstraResult {
   std::vector<Cost32> dist;
   std::vector<NodeId> parent;
@@ -19,6 +15,34 @@ struct DijkstraResult {
   PQMetrics pq;
 };
 
+// 워크스페이스 기반 결과: 벡터 복사 없이 워크스페이스를 들여다봄
+// (같은 워크스페이스로 다음 쿼리를 시작하면 무효)
+struct SearchView {
+  const SearchWorkspace* ws = nullptr;
+  DijkstraMetrics algo;
+  PQMetrics pq;
+
+  Cost32 dist(NodeId v) const { return ws->dist(v); }
+  NodeId parent(NodeId v) const { return ws->parent(v); }
+};
+
+SearchView dijkstra_single(const IGraph& G, NodeId s, IPQ& Q, SearchWorkspace& ws);
+
+// 계측 수준을 직접 고르는 dijkstra_single (dijkstra_single 은 빌드 기본 수준)
+// L=Detailed 면 hist 에 분포를 누적 (nullptr 이면 카운터만). Off/Counters 는 hist 무시
+template <MetricsLevel L>
+SearchView dijkstra_single_m(const IGraph& G, NodeId s, IPQ& Q, SearchWorkspace& ws,
+                             AlgoHistograms* hist = nullptr);
+
+// 한 출발점에서 여러 goal: goal 이 모두 settle 되면 멈춤 (정렬 큐에서만 조기 종료)
+// radius: 마지막으로 꺼낸 키 (조기 종료 안 했으면 INF) → dist(v) <= radius 인 노드는 확정
+SearchView dijkstra_multi(const IGraph& G, NodeId s, const NodeId* goals, std::size_t n,
+                          IPQ& Q, SearchWorkspace& ws, Cost32* radius = nullptr);
+
+// 단발 호출용: 내부 워크스페이스 결과를 N 크기 벡터로 복사
 DijkstraResult dijkstra_single(const IGraph& G, NodeId s, IPQ& Q);
 
+// SearchView → DijkstraResult (N 크기 벡터로 materialize)
+DijkstraResult to_result(const SearchView& V, std::size_t n);
+
 } // namespace pathlab
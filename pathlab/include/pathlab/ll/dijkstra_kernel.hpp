@@ -0,0 +1,57 @@
+#pragma once
+#include "pathlab/core/types.hpp"
+#include "pathlab/ll/dijkstra.hpp"
+#include "pathlab/ll/workspace.hpp"
+
+namespace pathlab {
+
+// 헤더 전용 Dijkstra 커널: 구체 그래프/큐 타입으로 인스턴스화
+// - Graph: for_each_neighbor(u, f(v, w)) 제공 (예: GridMap)
+// - PQ   : final 큐 타입 (HeapPQ / BucketPQ / STOCPQ) → 가상 호출 없이 직접 호출
+// - 탐색 계측 수준은 큐 타입에서 (pq_metrics_level): heap@off 면 카운터도 없음,
+//   Detailed 면 hist 에 분포 누적
+// 결과와 메트릭은 같은 수준의 dijkstra_single_m 과 동일해야 함
+template <class Graph, class PQ>
+SearchView dijkstra_kernel(const Graph& G, NodeId s, PQ& Q, SearchWorkspace& ws,
+                           AlgoHistograms* hist = nullptr) {
+  using AP = AlgoMetricsPolicy<pq_metrics_level<PQ>::value>;
+  const std::size_t N = G.num_nodes();
+  ws.begin(N);
+  AP am(hist);
+  am.begin(N);
+  Q.clear(); Q.reserve(N);
+
+  uint32_t tie = 0;
+  ws.set(s, 0, SearchWorkspace::INVALID);
+  Q.push(s, Key{0u, tie++});
+
+  while (!Q.empty()) {
+    const auto top = Q.pop();
+    const NodeId u = top.first;
+    am.settle();
+    const Cost32 du = ws.dist(u);
+    if constexpr (AP::kDetailed) am.observe_pop(u, top.second.primary, du, Q.size());
+
+    uint32_t imp = 0;
+    G.for_each_neighbor(u, [&](NodeId v, Cost32 w){
+      am.relax();
+      const uint64_t cand = (uint64_t)du + w;
+      if (cand < ws.dist(v)) {
+        ws.set(v, (Cost32)cand, u); am.improve();
+        if constexpr (AP::kDetailed) imp++;
+        Q.push_or_decrease(v, Key{(Cost32)cand, tie++});
+      }
+    });
+    am.expanded(imp);
+  }
+
+  return { &ws, am.counts(), Q.metrics() };
+}
+
+template <class Graph, class PQ>
+DijkstraResult dijkstra_kernel(const Graph& G, NodeId s, PQ& Q) {
+  SearchWorkspace ws(G.num_nodes());
+  return to_result(dijkstra_kernel(G, s, Q, ws), G.num_nodes());
+}
+
+} // namespace pathlab
@@ -0,0 +1,44 @@
+#pragma once
+#include <string>
+#include "pathlab/core/types.hpp"
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/queues/ipq.hpp"
+#include "pathlab/ll/dijkstra.hpp"
+#include "pathlab/ll/workspace.hpp"
+
+namespace pathlab {
+
+class JumpTable;
+class LandmarkTable;
+
+// 앱들이 공유하는 단일 쿼리 엔진 선택
+enum class Engine {
+  Dijkstra,    // dijkstra_single (IGraph/IPQ 가상 호출)
+  DijkstraT,   // dijkstra_kernel (구체 타입 템플릿)
+  AStar,       // astar_single
+  JPS,         // jps_single (온라인 점프)
+  JPSPlus,     // jps_single + JumpTable
+  ALT,         // alt_single + LandmarkTable
+};
+
+bool parse_engine(const std::string& name, Engine& out);
+const char* engine_name(Engine e);
+
+// 엔진이 goal 을 쓰는지 (Dijkstra 계열은 전체 트리)
+inline bool engine_goal_directed(Engine e) {
+  return e == Engine::AStar || e == Engine::JPS || e == Engine::JPSPlus ||
+         e == Engine::ALT;
+}
+
+// BucketPQ 에 필요한 키 증가 폭 (W = 그래프 최대 간선 코스트)
+// A*/ALT: consistent h 로 relax 당 최대 2W, JPS: 점프 한 번이 맵 한 변까지
+// (BucketPQ 는 범위를 넘는 키가 오면 스스로 링을 키우므로 초기 크기 힌트)
+uint32_t engine_bucket_width(Engine e, const GridMap& G);
+
+// jt 는 JPSPlus 에서만 사용 (nullptr 이면 온라인 JPS)
+// lt 는 ALT 에서만 사용 (nullptr 이면 octile A*)
+SearchView run_engine(Engine e, const GridMap& G, NodeId s, NodeId g,
+                      IPQ& Q, SearchWorkspace& ws, const JumpTable* jt = nullptr,
+                      const LandmarkTable* lt = nullptr);
+
+} // namespace pathlab
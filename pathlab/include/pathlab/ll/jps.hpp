@@ -0,0 +1,50 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "pathlab/core/types.hpp"
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/queues/ipq.hpp"
+#include "pathlab/ll/dijkstra.hpp"
+#include "pathlab/ll/workspace.hpp"
+
+namespace pathlab {
+
+// JPS+ 전처리 결과: 셀 × 8방향(GridMap::kDx8/kDy8 순서) 점프 거리
+//   v > 0 : v 칸 앞에 jump point
+//   v <= 0: jump point 없음, -v 칸까지 이동 가능(그 다음 칸이 벽/경계)
+// goal 은 쿼리 시점에 처리하므로 테이블은 goal 과 무관
+class JumpTable {
+public:
+  JumpTable() = default;
+
+  static JumpTable build(const GridMap& G);
+
+  // <map_path>.jps 캐시: 크기/통행 해시가 맞으면 로드, 아니면 build 후 저장 시도
+  static JumpTable load_or_build(const GridMap& G, const std::string& map_path,
+                                 bool* loaded = nullptr);
+  bool save(const std::string& path) const;
+  bool load(const std::string& path, const GridMap& G);
+
+  bool empty() const { return jump_.empty(); }
+  int16_t at(NodeId u, int dir) const { return jump_[(std::size_t)u * 8 + dir]; }
+
+  static std::string cache_path(const std::string& map_path) { return map_path + ".jps"; }
+
+private:
+  int W_ = 0, H_ = 0;
+  uint64_t hash_ = 0;
+  std::vector<int16_t> jump_;
+};
+
+// Jump Point Search (8-이웃 균일 코스트 그리드, GridMap 의 코너 통과 규칙 기준)
+// - plus == nullptr: 온라인 점프(칸 단위 스캔)
+// - plus != nullptr: JPS+ 테이블 조회로 점프
+// 키/종료 조건은 astar_single 과 동일. parent 는 jump point 사이를 잇는다.
+// allow_diag=0 그리드에서는 astar_single 로 대체
+SearchView jps_single(const GridMap& G, NodeId s, NodeId g, IPQ& Q,
+                      SearchWorkspace& ws, const JumpTable* plus = nullptr);
+DijkstraResult jps_single(const GridMap& G, NodeId s, NodeId g, IPQ& Q,
+                          const JumpTable* plus = nullptr);
+
+} // namespace pathlab
@@ -0,0 +1,42 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include "pathlab/core/types.hpp"
+
+namespace pathlab {
+
+// 쿼리 간 재사용되는 노드별 dist/parent 저장소
+// - begin()은 generation 만 올려 이전 쿼리 값을 O(1)로 무효화
+// - stamp != gen 인 슬롯은 (INF, INVALID) 로 읽힘
+// - stamp/dist/parent 를 한 슬롯(12B)에 묶어 노드당 캐시 라인 1회 접근
+class SearchWorkspace {
+public:
+  static constexpr NodeId INVALID = std::numeric_limits<NodeId>::max();
+
+  explicit SearchWorkspace(std::size_t n = 0);
+
+  void begin(std::size_t n);   // 새 쿼리 시작 (필요할 때만 확장)
+  std::size_t capacity() const { return slot_.size(); }
+
+  Cost32 dist(NodeId v) const {
+    const Slot& s = slot_[v];
+    return (s.stamp == gen_) ? s.dist : Key::INF;
+  }
+  NodeId parent(NodeId v) const {
+    const Slot& s = slot_[v];
+    return (s.stamp == gen_) ? s.parent : INVALID;
+  }
+  void set(NodeId v, Cost32 d, NodeId p) { slot_[v] = Slot{gen_, d, p}; }
+
+private:
+  struct Slot {
+    uint32_t stamp;
+    Cost32   dist;
+    NodeId   parent;
+  };
+  std::vector<Slot> slot_;
+  uint32_t gen_ = 1;
+};
+
+} // namespace pathlab
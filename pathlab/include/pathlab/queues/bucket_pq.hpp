@@ -1,10 +1,10 @@
 #pragma once
 #include <vector>
-#include <list>
 #include <cstdint>
 #include <optional>
 #include "pathlab/core/types.hpp"
 #include "pathlab/queues/ipq.hpp"
+#include "pathlab/util/metrics_policy.hpp"
 
 // Key의 '거리' 필드 접근자. (기본: .primary)
 // Key 구조가 다르면 아래 한 줄만 바꾸세요.
@@ -17,49 +17,84 @@
 
 namespace pathlab {
 
-// Dial-style Bucket PQ (monotone integer keys, edge w ∈ [1..W])
-class BucketPQ final : public IPQ {
+// Dial-style Bucket PQ (monotone integer keys)
+// - 큐 안의 키는 [cur_min_, cur_min_ + span] 범위여야 함. span 은 생성 시 max_w 로
+//   주고, 범위를 넘는 키가 들어오면 링을 2의 거듭제곱으로 키워 재배치
+// - bucket 은 노드별 prev/next 인덱스로 엮은 intrusive 리스트 → push/unlink O(1), 할당 없음
+// - 점유 비트맵 + find-first-set 으로 빈 bucket 을 한 번에 건너뜀
+// - metrics: scans=검사한 비트맵 워드 수, moves=decrease 재연결/링 확장 재배치
+// - L: 계측 수준 (Detailed 는 bucket 별 길이를 따로 유지해 pop 한 bucket 길이 분포를 기록)
+template <MetricsLevel L>
+class BasicBucketPQ final : public IPQ {
 public:
-  explicit BucketPQ(uint32_t max_w);
+  static constexpr MetricsLevel kMetricsLevel = L;
+
+  explicit BasicBucketPQ(uint32_t max_w);
 
   void reserve(std::size_t n) override;
   void clear() override;
-  bool empty() const override;
-  std::size_t size() const override;
+  bool empty() const override { return count_ == 0; }
+  std::size_t size() const override { return count_; }
 
   void push(NodeId u, Key k) override;
   void decrease(NodeId u, Key k) override;
+  bool push_or_decrease(NodeId u, Key k) override;
+  void push_batch(const PQItem* items, std::size_t n) override;
 
   std::pair<NodeId, Key> top() const override;
   std::pair<NodeId, Key> pop() override;
 
-  bool contains(NodeId u) const override;
+  bool contains(NodeId u) const override {
+    return (u < inq_.size()) && inq_[u];
+  }
   std::optional<Key> key_of(NodeId u) const override;
 
-  const PQMetrics& metrics() const override { return m_; }
-  void reset_metrics() override { m_ = {}; }
+  const PQMetrics& metrics() const override { return mp_.counts(); }
+  void reset_metrics() override { mp_.reset(); }
+  const PQHistograms* histograms() const override { return mp_.histograms(); }
+  bool counts_metrics() const override { return PQMetricsPolicy<L>::kCounters; }
+  bool requires_monotone() const override { return true; }
+
+  uint32_t bucket_count() const { return K_; }
 
 private:
+  static constexpr NodeId NIL = 0xffffffffu;
+
+  struct Node {
+    Key    key;
+    NodeId prev;
+    NodeId next;
+  };
+
   // state
-  Cost32   cur_min_ = 0;                // current minimal cost cursor
-  uint32_t W_       = 1;                // max edge weight (e.g., 14 for 10/14)
-  uint32_t K_       = 2;                // K = W_ + 1 (bucket count)
-  uint32_t offset_  = 0;                // (optional) cur_min_ % K_
+  Cost32   cur_min_ = 0;                // 큐 안 모든 키의 하한 (= 마지막 pop 키)
+  Cost32   hi_      = 0;                // 첫 pop 전까지 들어온 최대 키
+  bool     fresh_   = true;             // clear 후 아직 pop 전 (키 순서 자유)
+  uint32_t K_       = 2;                // bucket 수 (2의 거듭제곱, > span)
+  uint32_t mask_    = 1;                // K_ - 1
   uint32_t count_   = 0;                // number of items
 
-  std::vector<std::list<NodeId>> buckets_; // size K_
+  std::vector<NodeId>   head_;          // size K_
+  std::vector<NodeId>   tail_;          // size K_ (FIFO 순서 유지)
+  std::vector<uint64_t> occ_;           // 점유 비트맵, size ceil(K_/64)
 
   // node bookkeeping
-  std::vector<uint8_t>  inq_;           // in-queue flag
-  std::vector<Key>      key_;           // current key per node
-  std::vector<uint32_t> bidx_;          // bucket index per node
+  std::vector<uint8_t> inq_;            // in-queue flag
+  std::vector<Node>    node_;           // key + intrusive links
 
-  PQMetrics m_;
+  std::vector<uint32_t> blen_;          // size K_, Detailed 에서만 유지
 
-  // Dial: absolute distance modulo K
-  inline uint32_t bucket_index_for(Cost32 d) const {
-    return static_cast<uint32_t>(d % K_);
-  }
+  PQMetricsPolicy<L> mp_;
+
+  inline uint32_t bucket_index_for(Cost32 d) const { return d & mask_; }
+
+  void resize_ring_(uint32_t span);     // K_ >= span+1 이 되도록 (재배치 포함)
+  void admit_(Cost32 d);                // 키 d 가 링 범위에 들어오도록 커서/링 조정
+  void link_(NodeId v);                 // node_[v].key 기준 bucket 꼬리에 연결
+  void unlink_(NodeId v);
+  uint32_t next_occupied_(uint32_t from, uint64_t* words) const; // from 부터 원형 탐색
 };
 
+using BucketPQ = BasicBucketPQ<kDefaultMetricsLevel>;
+
 } // namespace pathlab
@@ -0,0 +1,122 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include "pathlab/core/types.hpp"
+#include "pathlab/queues/ipq.hpp"
+#include "pathlab/util/aligned_allocator.hpp"
+
+namespace pathlab {
+
+// d-ary 힙 공통 저장소
+// - Entry 는 16B (packed key 8B + NodeId + pad), 64B 정렬 버퍼에 저장
+// - 루트를 D-1 칸 뒤에 두어 노드 i 의 자식 그룹(D*i+1 .. D*i+D)이 D 칸 경계에서 시작
+//   → D=4 면 형제 4개가 캐시 라인 1개, D=8 이면 2개
+// - 키 비교는 (primary, tie) 를 64비트로 묶어 한 번에
+namespace detail {
+
+struct alignas(16) HeapEntry {
+  uint64_t k;
+  NodeId   u;
+  uint32_t pad;
+};
+
+inline uint64_t pack_key(Key k) { return ((uint64_t)k.primary << 32) | k.tie; }
+inline Key unpack_key(uint64_t k) { return Key{(Cost32)(k >> 32), (uint32_t)k}; }
+
+using HeapBuffer = std::vector<HeapEntry, AlignedAllocator<HeapEntry, 64>>;
+
+} // namespace detail
+
+// 인덱스 추적 d-ary 힙 (decrease 는 제자리 sift-up)
+// metrics: moves=엔트리 이동(hole 방식이라 이동 1회씩)
+template <unsigned D>
+class DaryHeapPQ final : public IPQ {
+  static_assert(D == 2 || D == 4 || D == 8, "arity must be 2, 4 or 8");
+public:
+  explicit DaryHeapPQ(std::size_t n_hint = 0);
+
+  void reserve(std::size_t n) override;
+  void clear() override;
+  bool empty() const override { return n_ == 0; }
+  std::size_t size() const override { return n_; }
+
+  void push(NodeId u, Key k) override;
+  void decrease(NodeId u, Key k) override;
+
+  std::pair<NodeId, Key> top() const override;
+  std::pair<NodeId, Key> pop() override;
+
+  bool contains(NodeId u) const override {
+    return (u < pos_.size()) && (pos_[u] != -1);
+  }
+  std::optional<Key> key_of(NodeId u) const override;
+
+  const PQMetrics& metrics() const override { return m_; }
+  void reset_metrics() override { m_ = {}; }
+
+private:
+  static constexpr std::size_t kOff = D - 1;
+  detail::HeapBuffer a_;     // [kOff, kOff + n_) 가 힙
+  std::size_t n_ = 0;
+  std::vector<int32_t> pos_;
+  PQMetrics m_;
+
+  detail::HeapEntry& at_(std::size_t i) { return a_[i + kOff]; }
+  const detail::HeapEntry& at_(std::size_t i) const { return a_[i + kOff]; }
+  void sift_up_(std::size_t i);
+  void sift_down_(std::size_t i);
+};
+
+// 지연 삭제 d-ary 힙: pos_ 없이 decrease 마다 새 엔트리 추가,
+// pop 시 best_ 와 다른(stale) 엔트리는 버림 (STOCPQ 와 같은 방식)
+// metrics: moves=엔트리 이동 + stale 폐기
+template <unsigned D>
+class LazyHeapPQ final : public IPQ {
+  static_assert(D == 2 || D == 4 || D == 8, "arity must be 2, 4 or 8");
+public:
+  explicit LazyHeapPQ(std::size_t n_hint = 0);
+
+  void reserve(std::size_t n) override;
+  void clear() override;
+  bool empty() const override { return live_ == 0; }
+  std::size_t size() const override { return live_; }
+
+  void push(NodeId u, Key k) override;
+  void decrease(NodeId u, Key k) override;
+
+  std::pair<NodeId, Key> top() const override;
+  std::pair<NodeId, Key> pop() override;
+
+  bool contains(NodeId u) const override {
+    return (u < best_.size()) && (best_[u] != kNone);
+  }
+  std::optional<Key> key_of(NodeId u) const override;
+
+  const PQMetrics& metrics() const override { return m_; }
+  void reset_metrics() override { m_ = {}; }
+
+private:
+  static constexpr std::size_t kOff = D - 1;
+  static constexpr uint64_t kNone = ~(uint64_t)0;
+  detail::HeapBuffer a_;
+  std::size_t n_ = 0;          // 힙 엔트리 수 (stale 포함)
+  std::size_t live_ = 0;       // 큐 안 노드 수
+  std::vector<uint64_t> best_; // 노드별 현재 packed key (kNone = 큐 밖)
+  mutable PQMetrics m_;
+
+  detail::HeapEntry& at_(std::size_t i) { return a_[i + kOff]; }
+  const detail::HeapEntry& at_(std::size_t i) const { return a_[i + kOff]; }
+  void insert_(NodeId u, uint64_t k);
+  void remove_top_();
+  void drop_stale_();          // 루트가 live 가 될 때까지 stale 제거
+};
+
+extern template class DaryHeapPQ<2>;
+extern template class DaryHeapPQ<4>;
+extern template class DaryHeapPQ<8>;
+extern template class LazyHeapPQ<2>;
+extern template class LazyHeapPQ<4>;
+extern template class LazyHeapPQ<8>;
+
+} // namespace pathlab
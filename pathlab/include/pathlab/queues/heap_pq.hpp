@@ -2,35 +2,47 @@
 #include <vector>
 #include <optional>
 #include "pathlab/queues/ipq.hpp"
+#include "pathlab/util/metrics_policy.hpp"
 
 namespace pathlab {
 
-class HeapPQ final : public IPQ {
+// L: 계측 수준 (Detailed 는 sift 한 번에 이동한 레벨 수 분포를 추가로 기록)
+// 구현은 heap_pq.cpp 에서 세 수준 모두 명시적 인스턴스화
+template <MetricsLevel L>
+class BasicHeapPQ final : public IPQ {
 public:
-  explicit HeapPQ(std::size_t n_hint = 0);
+  static constexpr MetricsLevel kMetricsLevel = L;
+
+  explicit BasicHeapPQ(std::size_t n_hint = 0);
 
   void reserve(std::size_t n) override;
   void clear() override;
-  bool empty() const override;
-  std::size_t size() const override;
+  bool empty() const override { return heap_.empty(); }
+  std::size_t size() const override { return heap_.size(); }
 
   void push(NodeId u, Key k) override;
   void decrease(NodeId u, Key k) override;
+  bool push_or_decrease(NodeId u, Key k) override;
+  void push_batch(const PQItem* items, std::size_t n) override;  // 새 엔트리는 한 번에 heapify
 
   std::pair<NodeId, Key> top() const override;
   std::pair<NodeId, Key> pop() override;
 
-  bool contains(NodeId u) const override;
+  bool contains(NodeId u) const override {
+    return (u < pos_.size()) && (pos_[u] != -1);
+  }
   std::optional<Key> key_of(NodeId u) const override;
 
-  const PQMetrics& metrics() const override { return m_; }
-  void reset_metrics() override { m_ = {}; }
+  const PQMetrics& metrics() const override { return mp_.counts(); }
+  void reset_metrics() override { mp_.reset(); }
+  const PQHistograms* histograms() const override { return mp_.histograms(); }
+  bool counts_metrics() const override { return PQMetricsPolicy<L>::kCounters; }
 
 private:
   struct Entry { NodeId u; Key k; };
   std::vector<Entry> heap_;
   std::vector<int32_t> pos_;
-  PQMetrics m_;
+  PQMetricsPolicy<L> mp_;
 
   bool less_(int a, int b) const;
   void swap_(int a, int b);
@@ -39,4 +51,6 @@ private:
   void ensure_pos_size_(std::size_t n);
 };
 
+using HeapPQ = BasicHeapPQ<kDefaultMetricsLevel>;
+
 } // namespace pathlab
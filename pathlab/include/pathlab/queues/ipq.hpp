@@ -7,6 +7,13 @@
 
 namespace pathlab {
 
+struct PQHistograms;   // util/metrics_policy.hpp
+
+struct PQItem {
+  NodeId u;
+  Key    k;
+};
+
 class IPQ {
 public:
   virtual ~IPQ() = default;
@@ -19,6 +26,23 @@ public:
   virtual void push(NodeId u, Key k) = 0;
   virtual void decrease(NodeId u, Key k) = 0;
 
+  // 없으면 push, 있으면 더 작은 키일 때만 decrease. 키가 바뀌었으면(삽입 포함) true
+  // (contains → push/decrease 두 번의 가상 호출·조회를 한 번으로; 기본 구현은 그대로 조합)
+  virtual bool push_or_decrease(NodeId u, Key k) {
+    if (contains(u)) {
+      const auto old = key_of(u);
+      if (old && !KeyLess{}(k, *old)) return false;
+      decrease(u, k);
+      return true;
+    }
+    push(u, k);
+    return true;
+  }
+  // 한 번의 확장에서 개선된 이웃들을 한꺼번에 push_or_decrease (같은 노드가 또 나오면 더 작은 키 유지)
+  virtual void push_batch(const PQItem* items, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) push_or_decrease(items[i].u, items[i].k);
+  }
+
   virtual std::pair<NodeId, Key> top() const = 0;
   virtual std::pair<NodeId, Key> pop() = 0;
 
@@ -27,6 +51,15 @@ public:
 
   virtual const PQMetrics& metrics() const = 0;
   virtual void reset_metrics() = 0;
+  // MetricsLevel::Detailed 로 만든 큐만 분포를 가짐 (그 외 nullptr)
+  virtual const PQHistograms* histograms() const { return nullptr; }
+  // MetricsLevel::Off 로 만든 큐는 metrics() 가 항상 0 → false (0 을 "연산 없음" 으로 읽지 않도록)
+  virtual bool counts_metrics() const { return true; }
+
+  // pop()이 항상 현재 최소 키를 돌려주는지 (목표 지향 탐색의 조기 종료 조건)
+  virtual bool ordered() const { return true; }
+  // push 키가 마지막 pop 키 이상이어야 동작하는지 (bucket/radix; 비단조 트레이스 재생 불가)
+  virtual bool requires_monotone() const { return false; }
 };
 
 } // namespace pathlab
@@ -0,0 +1,26 @@
+#pragma once
+#include <memory>
+#include <string>
+#include "pathlab/queues/ipq.hpp"
+
+namespace pathlab {
+
+// 이름으로 큐 생성: heap | stoc[_radix|_net] | bucket | radix | dary{2,4,8} | lazy{2,4,8}
+// stoc_block == 0 이면 STOCPQ 정렬 커널별 기본 블록 크기 (알 수 없으면 heap)
+// bucket_w: 한 번의 relax 로 키가 늘어날 수 있는 최대 폭 (Dijkstra=최대 가중치)
+// 이름 뒤 @off|@counters|@detailed: heap/stoc*/bucket 을 그 계측 수준으로 생성
+// (없으면 빌드 기본 수준 PATHLAB_METRICS, 다른 큐는 접미사를 무시)
+std::unique_ptr<IPQ> make_pq(const std::string& name,
+                             uint32_t stoc_block,
+                             uint32_t bucket_w);
+
+// name == "auto": <map_path>.pqprof 에서 (engine, graph_hash) 의 큐/블록 크기를 읽어 생성
+// (pq_tune 으로 생성, 프로파일이 없으면 heap). 그 외 이름은 위와 같음
+std::unique_ptr<IPQ> make_pq(const std::string& name,
+                             uint32_t stoc_block,
+                             uint32_t bucket_w,
+                             const std::string& map_path,
+                             const std::string& engine,
+                             uint64_t graph_hash);
+
+} // namespace pathlab
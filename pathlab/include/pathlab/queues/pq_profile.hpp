@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pathlab {
+
+// 맵별 큐 선택 결과 (pq_tune 이 측정해 기록)
+struct PQProfileEntry {
+  std::string engine;          // engine_name() 값
+  uint64_t    graph_hash = 0;  // 측정한 그래프 (allow_diag/맵 편집이 다르면 다른 항목)
+  std::string pq;              // make_pq 이름
+  uint32_t    stoc_block = 0;  // stoc* 에서만 의미 (0 = 정렬 커널 기본값)
+  double      ns_per_query = 0.0;
+  uint32_t    samples = 0;
+};
+
+// <map_path>.pqprof: (엔진, graph_hash) 마다 한 줄의 텍스트 파일
+//   # pathlab pq profile v2
+//   <engine> <graph_hash(hex)> <pq> <stoc_block> <ns_per_query> <samples>
+// graph_hash 가 다른 항목은 무시 (.jps/.ch/.alt 캐시와 같은 기준)
+class PQProfile {
+public:
+  static std::string cache_path(const std::string& map_path) { return map_path + ".pqprof"; }
+
+  bool load(const std::string& path);   // 파일이 없거나 형식이 다르면 false
+  bool save(const std::string& path) const;
+
+  const PQProfileEntry* find(const std::string& engine, uint64_t graph_hash) const;
+  void set(const PQProfileEntry& e);    // 같은 (엔진, graph_hash) 항목은 교체
+  const std::vector<PQProfileEntry>& entries() const { return entries_; }
+
+private:
+  std::vector<PQProfileEntry> entries_;
+};
+
+// name == "auto" 면 <map_path>.pqprof 의 (engine, graph_hash) 항목으로 name/stoc_block 을 바꿈
+// (프로파일이나 항목이 없으면 heap). 프로파일 항목을 썼으면 true
+bool resolve_auto_pq(const std::string& map_path, const std::string& engine, uint64_t graph_hash,
+                     std::string& name, uint32_t& stoc_block);
+
+} // namespace pathlab
@@ -0,0 +1,109 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "pathlab/queues/ipq.hpp"
+
+namespace pathlab {
+
+// 큐 연산 트레이스 (그래프 순회 비용 없이 큐만 비교하기 위한 기록/재생)
+//   파일: [32B 헤더 "PLPQTR1"][PQTraceRec × count]
+enum class PQOp : uint8_t { Push = 0, Decrease, Pop, Contains, Clear, Reserve };
+constexpr int kNumPQOps = 6;
+
+const char* pq_op_name(PQOp op);
+
+// 12B 레코드: op 는 상위 3비트, node 는 하위 29비트
+//   Push/Decrease: (node, key)  Pop: 꺼낸 (node, key)  Contains: node, cost=결과
+//   Reserve: cost=n            Clear: 필드 없음
+struct PQTraceRec {
+  uint32_t op_node;
+  Cost32   cost;
+  uint32_t tie;
+
+  static constexpr uint32_t kNodeBits = 29;
+  static constexpr uint32_t kNodeMask = (1u << kNodeBits) - 1;
+
+  PQOp   op() const   { return (PQOp)(op_node >> kNodeBits); }
+  NodeId node() const { return op_node & kNodeMask; }
+  Key    key() const  { return Key{cost, tie}; }
+};
+static_assert(sizeof(PQTraceRec) == 12, "trace record must stay 12 bytes");
+
+// 기록용 데코레이터: 내부 큐로 그대로 위임하면서 push/decrease/pop/contains/
+// clear/reserve 를 파일로 스트리밍 (empty/top/key_of 는 기록하지 않음)
+// dijkstra_single 등 IPQ& 를 받는 탐색에 그대로 끼워 쓸 수 있음
+class TracingPQ final : public IPQ {
+public:
+  TracingPQ(IPQ& inner, const std::string& path);
+  ~TracingPQ() override;
+  TracingPQ(const TracingPQ&) = delete;
+  TracingPQ& operator=(const TracingPQ&) = delete;
+
+  void reserve(std::size_t n) override;
+  void clear() override;
+  bool empty() const override { return q_.empty(); }
+  std::size_t size() const override { return q_.size(); }
+
+  void push(NodeId u, Key k) override;
+  void decrease(NodeId u, Key k) override;
+
+  std::pair<NodeId, Key> top() const override { return q_.top(); }
+  std::pair<NodeId, Key> pop() override;
+
+  bool contains(NodeId u) const override;
+  std::optional<Key> key_of(NodeId u) const override { return q_.key_of(u); }
+
+  const PQMetrics& metrics() const override { return q_.metrics(); }
+  void reset_metrics() override { q_.reset_metrics(); }
+  const PQHistograms* histograms() const override { return q_.histograms(); }
+  bool counts_metrics() const override { return q_.counts_metrics(); }
+  bool ordered() const override { return q_.ordered(); }
+  bool requires_monotone() const override { return q_.requires_monotone(); }
+
+  uint64_t records() const { return count_; }
+  void finish();   // 버퍼 flush + 헤더(count) 기록 후 닫음 (소멸자에서도 호출)
+
+private:
+  void rec_(PQOp op, NodeId u, Cost32 c, uint32_t t) const;
+  void flush_() const;
+
+  IPQ& q_;
+  std::string path_;
+  bool unordered_;
+  std::FILE* f_ = nullptr;
+  mutable std::vector<PQTraceRec> buf_;
+  mutable uint64_t count_ = 0;
+};
+
+struct PQTrace {
+  std::vector<PQTraceRec> recs;
+  bool unordered = false;   // 기록한 큐가 ordered() == false 였는지
+
+  static PQTrace load(const std::string& path);   // 실패 시 예외
+  // 마지막 pop 키 대비 push/decrease 키의 최대 증가폭 (BucketPQ 의 bucket_w 로 사용)
+  uint32_t max_key_span() const;
+  // 모든 push/decrease 키가 그때까지의 최대 pop 키 이상인지 (BucketPQ/RadixPQ 재생 가능 조건)
+  bool monotone() const;
+};
+
+struct PQReplayStats {
+  uint64_t ops[kNumPQOps] = {};
+  uint64_t pop_diff  = 0;   // 기록과 다른 노드를 꺼낸 pop 수 (비정렬 큐 등)
+  uint64_t diverged  = 0;   // contains 결과가 기록과 달라 push/decrease 를 바꾼 수
+  uint64_t skipped   = 0;   // 재생 큐가 비어 있어 건너뛴 pop 수
+  double   ns        = 0.0;
+
+  uint64_t total_ops() const {
+    uint64_t t = 0;
+    for (int i = 0; i < kNumPQOps; ++i) t += ops[i];
+    return t;
+  }
+};
+
+// 트레이스를 Q 에 재생. contains 바로 뒤의 push/decrease 는 Dijkstra 와 같이
+// 재생 큐의 contains 결과로 고름 → pop 순서가 달라도(동순위/비정렬 큐) 안전
+PQReplayStats replay_trace(const PQTrace& T, IPQ& Q);
+
+} // namespace pathlab
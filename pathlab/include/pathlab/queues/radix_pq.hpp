@@ -0,0 +1,63 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include "pathlab/core/types.hpp"
+#include "pathlab/queues/ipq.hpp"
+
+namespace pathlab {
+
+// Radix heap (monotone integer keys: push 키 >= 마지막 pop 키)
+// - bucket 0 은 last_ 와 같은 키, bucket i 는 (key ^ last_) 의 최상위 비트가 i-1
+// - bucket 0 이 비면 가장 낮은 비어있지 않은 bucket 의 최소 키로 last_ 를 옮기고
+//   그 bucket 을 더 낮은 bucket 들로 재분배 (엔트리당 최대 32회 이동)
+// - decrease 는 지연 처리: 새 엔트리 추가, 옛 엔트리는 pop 시 폐기
+// - 비교는 primary 만 사용 (tie 무시)
+// - metrics: moves=재분배/폐기, scans=bucket 탐색
+class RadixPQ final : public IPQ {
+public:
+  explicit RadixPQ(std::size_t n_hint = 0);
+
+  void reserve(std::size_t n) override;
+  void clear() override;
+  bool empty() const override { return count_ == 0; }
+  std::size_t size() const override { return count_; }
+
+  void push(NodeId u, Key k) override;
+  void decrease(NodeId u, Key k) override;
+
+  std::pair<NodeId, Key> top() const override;
+  std::pair<NodeId, Key> pop() override;
+
+  bool contains(NodeId u) const override {
+    return (u < inq_.size()) && inq_[u];
+  }
+  std::optional<Key> key_of(NodeId u) const override;
+
+  const PQMetrics& metrics() const override { return m_; }
+  void reset_metrics() override { m_ = {}; }
+  bool requires_monotone() const override { return true; }
+
+private:
+  static constexpr int kBuckets = 33;   // 0 + 32비트 키의 비트 위치별
+  struct Entry { NodeId u; Cost32 k; };
+
+  std::vector<Entry> buckets_[kBuckets];
+  uint64_t occupied_ = 0;               // bit i = buckets_[i] 비어있지 않음 (stale 포함)
+  Cost32   last_  = 0;                  // 마지막으로 꺼낸 최소 키
+  std::size_t count_ = 0;               // live 노드 수
+
+  std::vector<uint8_t> inq_;
+  std::vector<Key>     key_;
+
+  mutable PQMetrics m_;
+
+  static int bucket_of_(Cost32 k, Cost32 last) {
+    return (k == last) ? 0 : 32 - __builtin_clz(k ^ last);
+  }
+  bool live_(const Entry& e) const { return inq_[e.u] && key_[e.u].primary == e.k; }
+  void insert_(NodeId u, Cost32 k);
+  bool refill_();                       // bucket 0 에 live 엔트리 확보
+};
+
+} // namespace pathlab
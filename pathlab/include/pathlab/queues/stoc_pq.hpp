@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <algorithm>
 #include "pathlab/queues/ipq.hpp"
+#include "pathlab/util/metrics_policy.hpp"
 
 namespace pathlab {
 
@@ -13,28 +14,59 @@ namespace pathlab {
 // - 내부에는 "미정렬 블록" 두 종류 보관: batch(큐, 먼저 소진) / sorted(스택, 나중 소진)
 // - 필요할 때만 블록 하나를 꺼내 정렬해 active 블록으로 만들고, 그 안에서 1개씩 top/pop
 // - decrease-key는 "지연" 처리: best[u]만 최신으로 유지, stale 엔트리는 pop시 건너뜀
-// - metrics: scans=비교횟수(정렬/비교), moves=삽입/삭제/폐기 등의 재배치
+// - 블록 정렬 커널 선택: std::sort / LSD radix (packed (primary, tie) 64비트 키) /
+//   작은 블록용 branchless bitonic 네트워크
+// - metrics: scans=정렬 작업량(블록 단위로 계산: 비교 추정치/radix 패스×n/교환기 수),
+//   moves=삽입/삭제/폐기 등의 재배치
+// - L: 계측 수준 (Detailed 는 정렬 블록 크기 분포와 stale 폐기 수를 추가로 기록)
+
+enum class StocSortKernel : uint8_t {
+  Std,       // std::sort
+  Radix,     // LSD radix, 8비트 digit, 모든 키가 같은 digit 인 패스는 생략
+  Network,   // kNetworkMax 단위 run 을 bitonic 네트워크로 정렬 후 병합
+};
 
-class STOCPQ final : public IPQ {
+template <MetricsLevel L>
+class BasicSTOCPQ final : public IPQ {
 public:
-  explicit STOCPQ(uint32_t block_size = 256, Cost32 bound = Key::INF);
+  static constexpr MetricsLevel kMetricsLevel = L;
+  using SortKernel = StocSortKernel;   // 수준이 달라도 같은 enum
+  static constexpr uint32_t kNetworkMax = 64;
+
+  // block_size == 0 이면 커널별 기본값 (default_block_size)
+  explicit BasicSTOCPQ(uint32_t block_size = 0, Cost32 bound = Key::INF,
+                       SortKernel kernel = SortKernel::Std);
+
+  static uint32_t default_block_size(SortKernel kernel);
+  uint32_t block_size() const { return B_; }
+  SortKernel kernel() const { return kernel_; }
 
   void reserve(std::size_t n) override;
   void clear() override;
-  bool empty() const override;
-  std::size_t size() const override;
+  bool empty() const override {
+    return live_ == 0 && active_pos_ >= active_.size()
+           && batch_blocks_.empty() && sorted_blocks_.empty();
+  }
+  std::size_t size() const override { return live_; }
 
   void push(NodeId u, Key k) override;      // insert
   void decrease(NodeId u, Key k) override;  // lazy decrease
+  bool push_or_decrease(NodeId u, Key k) override;
+  void push_batch(const PQItem* items, std::size_t n) override;  // 블록 여유분에 통째로 append
 
   std::pair<NodeId, Key> top() const override; // 내부에서 active 준비, stale skip
   std::pair<NodeId, Key> pop() override;       // 위와 동일 + 실제 consume
 
-  bool contains(NodeId u) const override;
+  bool contains(NodeId u) const override {
+    return (u < best_.size()) && best_[u].has_value();
+  }
   std::optional<Key> key_of(NodeId u) const override;
 
-  const PQMetrics& metrics() const override { return m_; }
-  void reset_metrics() override { m_ = {}; }
+  const PQMetrics& metrics() const override { return mp_.counts(); }
+  void reset_metrics() override { mp_.reset(); }
+  const PQHistograms* histograms() const override { return mp_.histograms(); }
+  bool counts_metrics() const override { return PQMetricsPolicy<L>::kCounters; }
+  bool ordered() const override { return false; } // 블록 단위 부분 정렬
 
 private:
   using Item = std::pair<NodeId, Key>; // (vertex, key)
@@ -46,24 +78,33 @@ private:
   // 현재 정렬되어 소비 중인 블록
   std::vector<Item> active_;
   std::size_t active_pos_ = 0;
+  std::vector<Item> scratch_;   // radix 정렬용 (블록마다 재할당 방지)
 
   // per-node best key (지연 감소 처리)
   std::vector<std::optional<Key>> best_;
 
   uint32_t B_;         // 블록 크기
+  SortKernel kernel_;  // 블록 정렬 커널
   Cost32   bound_;     // 키 상한(>=bound 무시)
   std::size_t live_ = 0;   // 유효 엔트리 추정치(지연으로 과대 가능, stale 폐기 시 감소)
-  mutable PQMetrics m_;    // metrics
+  PQMetricsPolicy<L> mp_;  // metrics (top() 은 const_cast 로 갱신)
 
   // 내부 유틸
   void ensure_best_size_(std::size_t n);
+  bool accept_(NodeId u, Key k);                // best_ 갱신 (push/decrease 판정), 새 엔트리 필요하면 true
   void append_unsorted_(Item it);               // sorted_blocks 뒤에 채우기
   void prepend_batch_(std::vector<Item> blk);   // batch_blocks 앞에 넣기
 
   bool ensure_active_();                        // active 없으면 블록 하나 꺼내 정렬
+  void sort_active_();                          // kernel_ 로 active_ 정렬 + scans 계산
+  void sort_radix_();
+  void sort_network_();
+  uint64_t network_run_(Item* a, std::size_t n);  // n <= kNetworkMax, 교환기 수 반환
   bool skip_stale_forward_();                   // active_pos_부터 stale 폐기
   std::pair<NodeId, Key> peek_impl_();          // 비-const top 구현
   std::pair<NodeId, Key> pop_impl_();           // 비-const pop 구현
 };
 
+using STOCPQ = BasicSTOCPQ<kDefaultMetricsLevel>;
+
 } // namespace pathlab
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace pathlab {
+
+// pathlab_server 바이너리 프레이밍 (little-endian, 고정 크기 구조체 그대로 전송)
+//   [FrameHeader 16B][payload len B]
+// 요청/응답은 req_id 로 짝지음 → 클라이언트는 응답을 기다리지 않고 여러 요청을
+// 파이프라인으로 보낼 수 있고, 응답 순서는 요청 순서와 다를 수 있음
+constexpr uint32_t kFrameMagic  = 0x31464c50u;        // "PLF1"
+constexpr uint32_t kMaxFrameLen = 64u << 20;
+
+enum class MsgType : uint16_t {
+  LoadMap  = 1,      // payload: 맵 경로 (서버 기준)       → MapInfo
+  Query    = 2,      // payload: QueryHeader + QueryRec×n → Result
+  Shutdown = 3,      // 서버 종료 (응답 없음)
+  MapInfo  = 0x81,   // payload: MapInfoMsg
+  Result   = 0x82,   // payload: ResultHeader + n × {u32 dist, u32 npath, u32 node×npath}
+                     // 큰 배치는 여러 프레임으로 나눠 보냄 (마지막 프레임만 kFrameMore 없음)
+  Error    = 0xff,   // payload: 메시지 문자열
+};
+
+struct FrameHeader {
+  uint32_t magic;
+  uint32_t len;      // payload 바이트
+  uint16_t type;     // MsgType
+  uint16_t flags;    // kFrameMore
+  uint32_t req_id;
+};
+static_assert(sizeof(FrameHeader) == 16, "frame header must stay 16 bytes");
+
+constexpr uint16_t kFrameMore = 1;      // 같은 req_id 의 프레임이 더 옴
+
+constexpr uint8_t kQueryWantPath = 1;   // QueryHeader::flags
+
+struct QueryHeader {
+  uint32_t map_id;
+  uint8_t  engine;   // Engine 값 (Dijkstra..ALT)
+  uint8_t  flags;    // kQueryWantPath
+  uint16_t reserved;
+  uint32_t count;
+};
+static_assert(sizeof(QueryHeader) == 12, "query header must stay 12 bytes");
+
+struct QueryRec {
+  uint16_t sx, sy, gx, gy;
+};
+
+constexpr uint32_t kMapAllowDiag = 1;   // MapInfoMsg::flags: 서버가 대각 이동을 허용해 맵을 올림
+
+struct MapInfoMsg {
+  uint32_t map_id;
+  uint32_t width;
+  uint32_t height;
+  uint32_t flags;    // kMapAllowDiag
+};
+
+struct ResultHeader {
+  uint32_t count;
+  uint32_t first;    // 이 프레임 첫 결과의 요청 내 인덱스
+};
+
+// fd 전체 읽기/쓰기 (EINTR/부분 전송 처리). EOF·오류면 false
+bool read_full(int fd, void* buf, std::size_t n);
+bool write_full(int fd, const void* buf, std::size_t n);
+
+// 프레임 하나 읽기: 헤더 검사(magic, 최대 길이) 실패도 false
+bool read_frame(int fd, FrameHeader& h, std::vector<uint8_t>& payload);
+// 헤더 + payload 를 한 번의 write 로 (호출자가 fd 별로 직렬화)
+bool write_frame(int fd, MsgType type, uint32_t req_id, const void* payload, std::size_t len,
+                 uint16_t flags = 0);
+
+// payload 조립용: 구조체/배열을 바이트 버퍼 끝에 붙임
+inline void append_bytes(std::vector<uint8_t>& buf, const void* p, std::size_t n) {
+  const std::size_t at = buf.size();
+  buf.resize(at + n);
+  if (n) std::memcpy(buf.data() + at, p, n);
+}
+template <class T>
+inline void append_pod(std::vector<uint8_t>& buf, const T& v) { append_bytes(buf, &v, sizeof(T)); }
+
+// Unix 도메인 소켓: 실패 시 예외
+int unix_listen(const std::string& path, int backlog = 64);
+int unix_connect(const std::string& path);
+
+} // namespace pathlab
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+#include <new>
+
+namespace pathlab {
+
+// std::vector 용 정렬 할당자 (기본: 캐시 라인 64B)
+template <class T, std::size_t Align = 64>
+struct AlignedAllocator {
+  using value_type = T;
+  template <class U> struct rebind { using other = AlignedAllocator<U, Align>; };
+
+  AlignedAllocator() noexcept = default;
+  template <class U>
+  AlignedAllocator(const AlignedAllocator<U, Align>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+  }
+  void deallocate(T* p, std::size_t) noexcept {
+    ::operator delete(p, std::align_val_t(Align));
+  }
+
+  template <class U>
+  bool operator==(const AlignedAllocator<U, Align>&) const noexcept { return true; }
+  template <class U>
+  bool operator!=(const AlignedAllocator<U, Align>&) const noexcept { return false; }
+};
+
+} // namespace pathlab
@@ -9,6 +9,23 @@ struct PQMetrics {
   uint64_t decreases = 0;
   uint64_t moves = 0;
   uint64_t scans = 0;
+
+  PQMetrics& operator+=(const PQMetrics& o) {
+    pushes += o.pushes; pops += o.pops; decreases += o.decreases;
+    moves += o.moves; scans += o.scans;
+    return *this;
+  }
+};
+
+struct DijkstraMetrics {
+  uint64_t relaxations = 0;
+  uint64_t improved    = 0;
+  uint64_t settled     = 0;
+
+  DijkstraMetrics& operator+=(const DijkstraMetrics& o) {
+    relaxations += o.relaxations; improved += o.improved; settled += o.settled;
+    return *this;
+  }
 };
 
 } // namespace pathlab
@@ -0,0 +1,167 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "pathlab/core/types.hpp"
+#include "pathlab/util/counters.hpp"
+
+namespace pathlab {
+
+// 큐/탐색 계측 수준 (컴파일 타임 정책)
+// - Off:      모든 계측 호출이 빈 inline 함수 → 최적화 후 코드 없음, metrics() 는 0
+// - Counters: PQMetrics / DijkstraMetrics 카운터 (기존 동작)
+// - Detailed: 카운터 + 분포 히스토그램 (분석용, 추가 메모리/분기 있음)
+enum class MetricsLevel : uint8_t { Off = 0, Counters = 1, Detailed = 2 };
+
+// 빌드 기본값: CMake PATHLAB_METRICS (off|counters|detailed) → PATHLAB_METRICS_LEVEL
+#ifndef PATHLAB_METRICS_LEVEL
+  #define PATHLAB_METRICS_LEVEL 1
+#endif
+constexpr MetricsLevel kDefaultMetricsLevel = (MetricsLevel)PATHLAB_METRICS_LEVEL;
+
+// 큐 타입의 계측 수준 (템플릿 커널용): Basic*PQ<L> 는 kMetricsLevel,
+// 수준 인자가 없는 큐(radix, dary 등)는 빌드 기본값
+template <class PQ, class = void>
+struct pq_metrics_level { static constexpr MetricsLevel value = kDefaultMetricsLevel; };
+template <class PQ>
+struct pq_metrics_level<PQ, std::void_t<decltype(PQ::kMetricsLevel)>> {
+  static constexpr MetricsLevel value = PQ::kMetricsLevel;
+};
+
+const char* metrics_level_name(MetricsLevel l);
+bool parse_metrics_level(const std::string& s, MetricsLevel& out);   // off|counters|detailed
+
+// 값 분포: 0..15 는 값 그대로, 16 이상은 2의 거듭제곱 구간 [2^k, 2^(k+1))
+struct Histogram {
+  static constexpr int kBins = 16 + 60;
+  uint64_t bin[kBins] = {};
+  uint64_t count = 0, sum = 0, max = 0;
+
+  static int bin_of(uint64_t v) {
+    return v < 16 ? (int)v : 16 + (63 - __builtin_clzll(v)) - 4;
+  }
+  static uint64_t bin_lo(int b) { return b < 16 ? (uint64_t)b : (uint64_t)1 << (b - 12); }
+
+  void add(uint64_t v) {
+    ++bin[bin_of(v)]; ++count; sum += v;
+    if (v > max) max = v;
+  }
+  double mean() const { return count ? (double)sum / (double)count : 0.0; }
+  uint64_t percentile(double q) const;   // 해당 bin 의 하한
+  Histogram& operator+=(const Histogram& o);
+};
+
+struct PQHistograms {
+  Histogram sift_levels;    // HeapPQ: sift-up/down 한 번에 이동한 레벨 수 (힙 깊이 사용량)
+  Histogram bucket_size;    // BucketPQ: pop 한 bucket 의 pop 직전 길이
+  Histogram block_size;     // STOCPQ: 정렬한 블록 크기
+  uint64_t  stale_pops = 0; // STOCPQ: pop 중 건너뛴 stale 엔트리 (지연 decrease 의 잔해)
+
+  PQHistograms& operator+=(const PQHistograms& o);
+};
+
+struct AlgoHistograms {
+  Histogram improved_per_expansion;   // 확장 한 번에 개선된 이웃 수
+  Histogram frontier;                 // pop 시점 큐 크기
+  uint64_t  stale_pops = 0;           // pop 키 > 현재 dist (지연 큐가 남긴 구 엔트리)
+  uint64_t  reexpanded = 0;           // 이미 확장한 노드를 다시 확장 (비정렬 큐)
+
+  // reexpanded 판정용 확장 표시: 쿼리마다 generation 만 올려 배열을 재사용
+  // (호출자가 쿼리 간에 같은 객체를 넘기므로 여기에 둠; operator+= 는 무시)
+  std::vector<uint32_t> seen;
+  uint32_t gen = 0;
+
+  AlgoHistograms& operator+=(const AlgoHistograms& o);
+};
+
+inline const PQMetrics kNoPQMetrics{};   // Off 수준의 metrics()
+
+// ------------------------------------------------------------- 큐 계측 정책
+template <MetricsLevel L> struct PQMetricsPolicy;
+
+template <> struct PQMetricsPolicy<MetricsLevel::Off> {
+  static constexpr bool kCounters = false, kDetailed = false;
+  void push() {}
+  void pop() {}
+  void decrease() {}
+  void move(uint64_t = 1) {}
+  void scan(uint64_t = 1) {}
+  void sift_levels(uint64_t) {}
+  void bucket_size(uint64_t) {}
+  void block_size(uint64_t) {}
+  void stale_pop() {}
+  const PQMetrics& counts() const { return kNoPQMetrics; }
+  const PQHistograms* histograms() const { return nullptr; }
+  void reset() {}
+};
+
+template <> struct PQMetricsPolicy<MetricsLevel::Counters> {
+  static constexpr bool kCounters = true, kDetailed = false;
+  PQMetrics m;
+  void push() { m.pushes++; }
+  void pop() { m.pops++; }
+  void decrease() { m.decreases++; }
+  void move(uint64_t n = 1) { m.moves += n; }
+  void scan(uint64_t n = 1) { m.scans += n; }
+  void sift_levels(uint64_t) {}
+  void bucket_size(uint64_t) {}
+  void block_size(uint64_t) {}
+  void stale_pop() {}
+  const PQMetrics& counts() const { return m; }
+  const PQHistograms* histograms() const { return nullptr; }
+  void reset() { m = {}; }
+};
+
+template <> struct PQMetricsPolicy<MetricsLevel::Detailed>
+    : PQMetricsPolicy<MetricsLevel::Counters> {
+  static constexpr bool kDetailed = true;
+  PQHistograms h;
+  void sift_levels(uint64_t n) { h.sift_levels.add(n); }
+  void bucket_size(uint64_t n) { h.bucket_size.add(n); }
+  void block_size(uint64_t n) { h.block_size.add(n); }
+  void stale_pop() { h.stale_pops++; }
+  const PQHistograms* histograms() const { return &h; }
+  void reset() { m = {}; h = {}; }
+};
+
+// ------------------------------------------------------------- 탐색 계측 정책
+template <MetricsLevel L> struct AlgoMetricsPolicy;
+
+template <> struct AlgoMetricsPolicy<MetricsLevel::Off> {
+  static constexpr bool kDetailed = false;
+  explicit AlgoMetricsPolicy(AlgoHistograms* = nullptr) {}
+  void begin(std::size_t) {}
+  void relax() {}
+  void improve() {}
+  void settle() {}
+  void expanded(uint32_t) {}
+  DijkstraMetrics counts() const { return {}; }
+};
+
+template <> struct AlgoMetricsPolicy<MetricsLevel::Counters> {
+  static constexpr bool kDetailed = false;
+  DijkstraMetrics m;
+  explicit AlgoMetricsPolicy(AlgoHistograms* = nullptr) {}
+  void begin(std::size_t) {}
+  void relax() { m.relaxations++; }
+  void improve() { m.improved++; }
+  void settle() { m.settled++; }
+  void expanded(uint32_t) {}
+  DijkstraMetrics counts() const { return m; }
+};
+
+// 분포는 호출자가 넘긴 AlgoHistograms 에 누적 (nullptr 이면 카운터만)
+template <> struct AlgoMetricsPolicy<MetricsLevel::Detailed>
+    : AlgoMetricsPolicy<MetricsLevel::Counters> {
+  static constexpr bool kDetailed = true;
+  AlgoHistograms* h;
+  explicit AlgoMetricsPolicy(AlgoHistograms* out = nullptr) : h(out) {}
+  void begin(std::size_t n);
+  // key: pop 키, dist: 현재 dist, qsize: pop 직후 큐 크기
+  // (인자 계산에 가상 호출이 들어가므로 호출부는 if constexpr (kDetailed) 로 감쌈)
+  void observe_pop(NodeId u, Cost32 key, Cost32 dist, std::size_t qsize);
+  void expanded(uint32_t improved) { if (h) h->improved_per_expansion.add(improved); }
+};
+
+} // namespace pathlab
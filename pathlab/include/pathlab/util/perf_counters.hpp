@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+
+namespace pathlab {
+
+// perf_event_open 하드웨어 카운터 (Linux 전용, 사용자 공간만 측정)
+enum class HwEvent : uint8_t { Cycles = 0, Instructions, L1DMiss, LLCMiss, BranchMiss };
+constexpr int kNumHwEvents = 5;
+
+const char* hw_event_name(HwEvent e);
+
+struct HwCounts {
+  uint64_t v[kNumHwEvents] = {};
+  bool     ok[kNumHwEvents] = {};   // 열리지 않은 이벤트는 false
+
+  uint64_t operator[](HwEvent e) const { return v[(int)e]; }
+  bool has(HwEvent e) const { return ok[(int)e]; }
+  HwCounts& operator+=(const HwCounts& o) {
+    for (int i = 0; i < kNumHwEvents; ++i) { v[i] += o.v[i]; ok[i] = ok[i] || o.ok[i]; }
+    return *this;
+  }
+};
+
+// cycles 를 리더로 한 이벤트 그룹으로 연다: reset/enable/disable 이 한 번의 ioctl 로
+// 모든 이벤트에 적용되고, 한 번의 read 로 같은 구간 값을 받음 (IPC 등 비율이 정확)
+// 지원하지 않는 이벤트는 그룹에서 빠짐. 리더를 못 열거나 PMU 가 그룹을 올리지 못하면
+// 이벤트를 하나씩 따로 여는 방식으로 대체
+// 컨테이너/VM 등에서 권한이 없으면 available() == false, start/stop 은 no-op
+// 멀티플렉싱된 경우 time_enabled/time_running 비율로 보정 (그룹은 한 비율)
+class PerfCounters {
+public:
+  PerfCounters();
+  ~PerfCounters();
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters& operator=(const PerfCounters&) = delete;
+
+  bool available() const { return opened_ > 0; }
+  bool has(HwEvent e) const { return fd_[(int)e] >= 0; }
+  bool grouped() const { return grouped_; }
+
+  void start();           // reset + enable
+  HwCounts stop();        // disable + read
+
+private:
+  int fd_[kNumHwEvents];
+  int opened_ = 0;
+  bool grouped_ = false;
+  int order_[kNumHwEvents] = {};   // 그룹 read 의 값 순서 (이벤트 번호)
+  int n_group_ = 0;
+
+  bool open_group_();
+  void open_single_();
+  void close_all_();
+};
+
+} // namespace pathlab
@@ -0,0 +1,121 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace pathlab {
+
+struct SampleStats {
+  std::size_t n = 0;
+  double min = 0.0, max = 0.0;
+  double mean = 0.0, stddev = 0.0;   // 표본 표준편차 (n-1)
+  double median = 0.0, p90 = 0.0, p99 = 0.0;
+};
+
+// 정렬된 표본의 q 분위수 (선형 보간)
+inline double percentile_sorted(const std::vector<double>& s, double q) {
+  if (s.empty()) return 0.0;
+  const double pos = q * (double)(s.size() - 1);
+  const std::size_t i = (std::size_t)pos;
+  if (i + 1 >= s.size()) return s.back();
+  return s[i] + (s[i + 1] - s[i]) * (pos - (double)i);
+}
+
+inline SampleStats summarize(std::vector<double> v) {
+  SampleStats st;
+  st.n = v.size();
+  if (v.empty()) return st;
+  std::sort(v.begin(), v.end());
+  st.min = v.front(); st.max = v.back();
+  double sum = 0.0;
+  for (double x : v) sum += x;
+  st.mean = sum / (double)v.size();
+  double ss = 0.0;
+  for (double x : v) ss += (x - st.mean) * (x - st.mean);
+  st.stddev = (v.size() > 1) ? std::sqrt(ss / (double)(v.size() - 1)) : 0.0;
+  st.median = percentile_sorted(v, 0.5);
+  st.p90 = percentile_sorted(v, 0.9);
+  st.p99 = percentile_sorted(v, 0.99);
+  return st;
+}
+
+// 양측 정규 p-value
+inline double normal_p2(double z) { return std::erfc(std::fabs(z) / std::sqrt(2.0)); }
+
+// 정규화 불완전 베타 I_x(a,b) (연분수 전개, t 분포 p-value 용)
+inline double incbeta(double a, double b, double x) {
+  if (x <= 0.0) return 0.0;
+  if (x >= 1.0) return 1.0;
+  if (x > (a + 1.0) / (a + b + 2.0)) return 1.0 - incbeta(b, a, 1.0 - x);
+  const double lbeta = std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b);
+  const double front = std::exp(std::log(x) * a + std::log(1.0 - x) * b + lbeta) / a;
+  const double tiny = 1e-300;
+  double f = 1.0, c = 1.0, d = 0.0;
+  for (int i = 0; i <= 200; ++i) {
+    const int m = i / 2;
+    double num;
+    if (i == 0) num = 1.0;
+    else if (i % 2 == 0) num = (m * (b - m) * x) / ((a + 2.0 * m - 1.0) * (a + 2.0 * m));
+    else num = -((a + m) * (a + b + m) * x) / ((a + 2.0 * m) * (a + 2.0 * m + 1.0));
+    d = 1.0 + num * d;
+    if (std::fabs(d) < tiny) d = tiny;
+    d = 1.0 / d;
+    c = 1.0 + num / c;
+    if (std::fabs(c) < tiny) c = tiny;
+    const double cd = c * d;
+    f *= cd;
+    if (std::fabs(1.0 - cd) < 1e-10) break;
+  }
+  return front * (f - 1.0);
+}
+
+// Student t (자유도 df) 양측 p-value
+inline double student_t_p2(double t, double df) {
+  if (!(df > 0.0)) return 1.0;
+  return incbeta(df / 2.0, 0.5, df / (df + t * t));
+}
+
+// Welch t-검정 (평균/표준편차/표본 수로), 양측 p-value. 표본이 부족하면 1
+inline double welch_p2(double m1, double s1, std::size_t n1,
+                       double m2, double s2, std::size_t n2) {
+  if (n1 < 2 || n2 < 2) return 1.0;
+  const double v1 = s1 * s1 / (double)n1, v2 = s2 * s2 / (double)n2;
+  const double se2 = v1 + v2;
+  if (se2 <= 0.0) return (m1 == m2) ? 1.0 : 0.0;
+  const double t = (m2 - m1) / std::sqrt(se2);
+  const double df = se2 * se2 / (v1 * v1 / (double)(n1 - 1) + v2 * v2 / (double)(n2 - 1));
+  return student_t_p2(t, df);
+}
+
+// Wilcoxon 부호 순위 검정 (대응 차이 d, 0 은 제외, 정규 근사 + 동순위 보정)
+// z > 0 이면 차이가 양수 쪽으로 치우침
+struct SignedRankResult { std::size_t n = 0; double z = 0.0, p = 1.0; };
+
+inline SignedRankResult wilcoxon_signed_rank(const std::vector<double>& d) {
+  std::vector<std::pair<double, int>> a;   // (|d|, sign)
+  a.reserve(d.size());
+  for (double x : d) if (x != 0.0) a.push_back({std::fabs(x), x > 0.0 ? 1 : -1});
+  SignedRankResult r;
+  r.n = a.size();
+  if (r.n == 0) return r;
+  std::sort(a.begin(), a.end(), [](const auto& x, const auto& y) { return x.first < y.first; });
+  double w = 0.0, tie_adj = 0.0;
+  for (std::size_t i = 0; i < a.size();) {
+    std::size_t j = i;
+    while (j < a.size() && a[j].first == a[i].first) ++j;
+    const double rank = (double)(i + 1 + j) / 2.0;   // 평균 순위
+    for (std::size_t k = i; k < j; ++k) w += rank * a[k].second;
+    const double t = (double)(j - i);
+    tie_adj += t * t * t - t;
+    i = j;
+  }
+  const double n = (double)r.n;
+  const double var = n * (n + 1.0) * (2.0 * n + 1.0) / 6.0 - tie_adj / 12.0;
+  if (var <= 0.0) return r;
+  r.z = w / std::sqrt(var);
+  r.p = normal_p2(r.z);
+  return r;
+}
+
+} // namespace pathlab
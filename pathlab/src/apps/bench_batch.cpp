@@ -0,0 +1,183 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/io/scen_loader.hpp"
+#include "pathlab/ll/engine.hpp"
+#include "pathlab/ll/jps.hpp"
+#include "pathlab/ll/alt.hpp"
+#include "pathlab/batch/batch_runner.hpp"
+#include "pathlab/batch/query_planner.hpp"
+#include "pathlab/queues/pq_profile.hpp"
+
+using namespace pathlab;
+
+int main(int argc, char** argv) {
+  // 위치 인자 + "--key=value" 옵션
+  std::vector<std::string> pos;
+  std::string engine_str = "astar";
+  unsigned max_threads = std::thread::hardware_concurrency();
+  uint32_t chunk = 8;
+  uint32_t landmarks = 16;
+  std::string select_str = "farthest";
+  std::size_t stream = 0;   // >0: ScenReader 로 이 크기씩 파싱하며 바로 풂
+  bool plan = false;        // 출발점별 묶음 풀이 (QueryPlanner)
+  uint32_t fanout = 1;      // 연속 fanout 개 케이스가 출발점 공유 (one-to-many 시뮬레이션)
+  std::size_t cache = 0;    // QueryPlanner 트리 LRU 용량
+  int passes = 1;
+  for (int i = 1; i < argc; ++i) {
+    std::string a = argv[i];
+    if      (a.rfind("--engine=", 0) == 0)  engine_str = a.substr(9);
+    else if (a.rfind("--threads=", 0) == 0) max_threads = (unsigned)std::strtoul(a.c_str() + 10, nullptr, 10);
+    else if (a.rfind("--chunk=", 0) == 0)   chunk = (uint32_t)std::strtoul(a.c_str() + 8, nullptr, 10);
+    else if (a.rfind("--landmarks=", 0) == 0) landmarks = (uint32_t)std::strtoul(a.c_str() + 12, nullptr, 10);
+    else if (a.rfind("--select=", 0) == 0)  select_str = a.substr(9);
+    else if (a.rfind("--stream=", 0) == 0)  stream = (std::size_t)std::strtoull(a.c_str() + 9, nullptr, 10);
+    else if (a == "--plan")                 plan = true;
+    else if (a.rfind("--fanout=", 0) == 0)  fanout = (uint32_t)std::strtoul(a.c_str() + 9, nullptr, 10);
+    else if (a.rfind("--cache=", 0) == 0)   cache = (std::size_t)std::strtoull(a.c_str() + 8, nullptr, 10);
+    else if (a.rfind("--passes=", 0) == 0)  passes = std::atoi(a.c_str() + 9);
+    else pos.push_back(a);
+  }
+  Engine engine = Engine::AStar;
+  LandmarkSelect select = LandmarkSelect::Farthest;
+  if (pos.size() < 4 || !parse_engine(engine_str, engine) ||
+      !parse_landmark_select(select_str, select)) {
+    std::fprintf(stderr,
+      "usage: bench_batch <map> <scen> <pq:heap|stoc[_radix|_net]|bucket|radix|dary{2,4,8}|lazy{2,4,8}|auto> <cases>\n"
+      "       [allow_diag=1] [stoc_block=0 (kernel default)] [--engine=astar|...] [--threads=nproc] [--chunk=8]\n"
+      "       [--landmarks=16] [--select=farthest|avoid] [--stream=batch]\n"
+      "       [--fanout=1] [--plan [--cache=0] [--passes=1]]\n");
+    return 1;
+  }
+  if (max_threads == 0) max_threads = 1;
+  if (fanout == 0) fanout = 1;
+  if ((plan || fanout > 1) && stream) {
+    std::fprintf(stderr, "--plan/--fanout cannot be combined with --stream\n");
+    return 1;
+  }
+
+  std::string map_path  = pos[0];
+  std::string scen_path = pos[1];
+  int cases = std::atoi(pos[3].c_str());
+  int allow_diag = (pos.size() > 4) ? std::atoi(pos[4].c_str()) : 1;
+  uint32_t stoc_block = (pos.size() > 5) ? (uint32_t)std::strtoul(pos[5].c_str(), nullptr, 10) : 0u;
+
+  GridMap G(map_path, allow_diag != 0);
+  std::vector<BatchQuery> Q;   // 스트리밍은 케이스를 미리 만들지 않음 (파일 전체를 배치 단위로)
+  if (!stream) {
+    auto S = load_scen(scen_path);
+    if (cases <= 0 || cases > (int)S.size()) cases = (int)S.size();
+    Q.resize((std::size_t)cases);
+    for (int i = 0; i < cases; ++i) {
+      Q[i].s = node_from_xy(S[i].sx, S[i].sy, G.width());
+      Q[i].g = node_from_xy(S[i].gx, S[i].gy, G.width());
+    }
+    for (int i = 0; i < cases; ++i) Q[i].s = Q[i - i % (int)fanout].s;
+  }
+
+  JumpTable jt;
+  if (engine == Engine::JPSPlus) jt = JumpTable::load_or_build(G, map_path);
+  LandmarkTable lt;
+  if (engine == Engine::ALT)
+    lt = LandmarkTable::load_or_build(G, map_path, landmarks, select, max_threads);
+
+  BatchOptions opt;
+  opt.pq = pos[2];
+  if (opt.pq == "auto") {
+    const bool prof = resolve_auto_pq(map_path, engine_name(engine), graph_hash(G), opt.pq, stoc_block);
+    std::fprintf(stderr, "pq auto -> %s block=%u (%s)\n", opt.pq.c_str(), stoc_block,
+                 prof ? PQProfile::cache_path(map_path).c_str() : "no profile entry, default");
+  }
+  opt.stoc_block = stoc_block;
+  opt.engine = engine;
+  opt.jt = &jt;
+  opt.lt = &lt;
+  opt.chunk = chunk;
+
+  // 1 → max_threads 까지 스케일링 측정, 결과는 1-스레드 실행과 비교
+  // 출발점별 묶음: 쿼리마다 탐색(1-스레드 run_batch)과 비교
+  if (plan) {
+    opt.threads = 1;
+    const BatchReport R = run_batch(G, Q, opt);
+    std::printf("per-query engine=%s queries=%d time=%.3fms qps=%.1f\n",
+                engine_name(engine), cases, R.wall_ms, R.qps);
+
+    PlannerOptions popt;
+    popt.pq = opt.pq;
+    popt.stoc_block = stoc_block;
+    popt.bucket_w = G.max_edge_cost();
+    popt.cache_trees = cache;
+    QueryPlanner P(G, popt);
+    for (int p = 1; p <= std::max(1, passes); ++p) {
+      P.reset_stats();
+      const auto t0 = std::chrono::steady_clock::now();
+      const std::vector<Cost32> D = P.solve(Q);
+      const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+      const PlannerStats& st = P.stats();
+      std::printf("plan pass=%d queries=%llu sources=%llu searches=%llu cache_hits=%llu "
+                  "settled=%llu time=%.3fms qps=%.1f speedup=%.2f%s\n",
+                  p, (unsigned long long)st.queries, (unsigned long long)st.sources,
+                  (unsigned long long)st.searches, (unsigned long long)st.cache_hits,
+                  (unsigned long long)st.algo.settled, ms,
+                  ms > 0.0 ? (double)cases * 1000.0 / ms : 0.0,
+                  ms > 0.0 ? R.wall_ms / ms : 0.0,
+                  D == R.dist ? "" : " MISMATCH");
+    }
+    return 0;
+  }
+
+  // 스트리밍 모드는 파싱 시간까지 포함, 결과는 run_batch(1-스레드) 와 비교
+  // (기준값도 stream 크기씩 읽어 배치마다 풂 → 케이스 전체를 들고 있지 않음)
+  std::vector<Cost32> ref;
+  double base_qps = 0.0;
+  if (stream) {
+    opt.threads = 1;
+    ScenReader rr(scen_path);
+    std::vector<ScenRecord> buf;
+    std::vector<BatchQuery> bq;
+    while (rr.next(buf, stream)) {
+      bq.resize(buf.size());
+      for (std::size_t i = 0; i < buf.size(); ++i) {
+        bq[i].s = node_from_xy(buf[i].sx, buf[i].sy, G.width());
+        bq[i].g = node_from_xy(buf[i].gx, buf[i].gy, G.width());
+      }
+      const std::vector<Cost32> d = run_batch(G, bq, opt).dist;
+      ref.insert(ref.end(), d.begin(), d.end());
+    }
+    cases = (int)ref.size();
+  }
+  ScenReader reader(scen_path);
+  for (unsigned T = 1; T <= max_threads; ++T) {
+    opt.threads = T;
+    BatchReport R;
+    if (stream) {
+      reader.rewind();
+      R = run_batch_stream(G, reader, opt, stream);
+    } else {
+      R = run_batch(G, Q, opt);
+    }
+    if (T == 1) { if (!stream) ref = R.dist; base_qps = R.qps; }
+    const bool same = (R.dist == ref);
+
+    std::printf("%sthreads=%u queries=%d time=%.3fms qps=%.1f speedup=%.2f eff=%.2f%s\n",
+                stream ? "stream " : "", T, cases, R.wall_ms, R.qps,
+                base_qps > 0.0 ? R.qps / base_qps : 0.0,
+                base_qps > 0.0 ? R.qps / base_qps / (double)T : 0.0,
+                same ? "" : " MISMATCH");
+    for (unsigned t = 0; t < T; ++t) {
+      const auto& st = R.threads[t];
+      std::printf("  t%u queries=%llu steals=%llu busy=%.3fms settled=%llu\n",
+                  t,
+                  (unsigned long long)st.queries,
+                  (unsigned long long)st.steals,
+                  st.busy_ms,
+                  (unsigned long long)st.algo.settled);
+    }
+  }
+  return 0;
+}
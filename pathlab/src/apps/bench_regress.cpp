@@ -0,0 +1,634 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <algorithm>
+#include <csignal>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/io/scen_loader.hpp"
+#include "pathlab/io/bench_report.hpp"
+#include "pathlab/queues/pq_factory.hpp"
+#include "pathlab/queues/heap_pq.hpp"
+#include "pathlab/ll/engine.hpp"
+#include "pathlab/ll/jps.hpp"
+#include "pathlab/ll/alt.hpp"
+#include "pathlab/util/stats.hpp"
+
+using namespace pathlab;
+
+namespace {
+
+// 설정 파일 (한 줄에 하나, '#' 이후 주석)
+//   reps N / warmup N / threshold X / alpha X / metrics_tol X / baselines <dir> / expected <dir>
+//   run <map> <scen> <pq[:block],...> <engine,...> [cases=0(전체)]
+struct RunSpec {
+  std::string map, scen, pq, engine;
+  uint32_t stoc_block = 0;   // 0 = 정렬 커널별 기본 (STOCPQ::default_block_size)
+  int cases = 0;
+};
+
+struct RegressConfig {
+  uint32_t reps = 5, warmup = 1;
+  CompareOptions cmp{0.01, 0.10};
+  double metrics_tol = 0.0;        // 큐 연산 총수 증가 허용 비율
+  std::string baselines = "logs/baselines";        // 시간 기준 (기계별, 커밋 안 함)
+  std::string expected = "pathlab/data/regress";   // dist + 큐 연산 수 기대값 (커밋)
+  std::vector<RunSpec> runs;
+};
+
+std::vector<std::string> split_list(const std::string& s) {
+  std::vector<std::string> out;
+  std::stringstream ss(s);
+  std::string item;
+  while (std::getline(ss, item, ',')) if (!item.empty()) out.push_back(item);
+  return out;
+}
+
+RegressConfig load_config(const std::string& path) {
+  std::ifstream ifs(path);
+  if (!ifs) throw std::runtime_error("cannot open config: " + path);
+  RegressConfig C;
+  std::string line;
+  int lineno = 0;
+  while (std::getline(ifs, line)) {
+    ++lineno;
+    const auto hash = line.find('#');
+    if (hash != std::string::npos) line.resize(hash);
+    std::istringstream ss(line);
+    std::string key;
+    if (!(ss >> key)) continue;
+    bool ok = true;
+    if      (key == "reps")        ok = (bool)(ss >> C.reps);
+    else if (key == "warmup")      ok = (bool)(ss >> C.warmup);
+    else if (key == "threshold")   ok = (bool)(ss >> C.cmp.threshold);
+    else if (key == "alpha")       ok = (bool)(ss >> C.cmp.alpha);
+    else if (key == "metrics_tol") ok = (bool)(ss >> C.metrics_tol);
+    else if (key == "baselines")   ok = (bool)(ss >> C.baselines);
+    else if (key == "expected")    ok = (bool)(ss >> C.expected);
+    else if (key == "run") {
+      std::string map, scen, pqs, engines;
+      int cases = 0;
+      ok = (bool)(ss >> map >> scen >> pqs >> engines);
+      ss >> cases;
+      // pq × engine 조합 전개
+      for (const auto& pq : split_list(pqs)) {
+        for (const auto& e : split_list(engines)) {
+          RunSpec r;
+          r.map = map; r.scen = scen; r.engine = e; r.cases = cases;
+          const auto colon = pq.find(':');
+          r.pq = pq.substr(0, colon);
+          if (colon != std::string::npos) r.stoc_block = (uint32_t)std::strtoul(pq.c_str() + colon + 1, nullptr, 10);
+          C.runs.push_back(r);
+        }
+      }
+    } else ok = false;
+    if (!ok) throw std::runtime_error(path + ":" + std::to_string(lineno) + ": bad line");
+  }
+  if (C.reps == 0) C.reps = 1;
+  return C;
+}
+
+std::string stem(const std::string& path) {
+  std::string b = path.substr(path.find_last_of('/') + 1);
+  const auto dot = b.rfind('.');
+  return dot == std::string::npos ? b : b.substr(0, dot);
+}
+
+// 설정 조합마다 기준/기대값 파일 이름: <dir>/<map>__<scen>__<pq[_bN]>__<engine>.csv
+std::string run_file(const std::string& dir, const RunSpec& r) {
+  std::string pq = r.pq;
+  if (pq.rfind("stoc", 0) == 0) pq += "_b" + std::to_string(r.stoc_block);
+  std::string e = r.engine;
+  std::replace(e.begin(), e.end(), '+', 'p');
+  return dir + "/" + stem(r.map) + "__" + stem(r.scen) + "__" + pq + "__" + e + ".csv";
+}
+
+bool file_exists(const std::string& p) {
+  struct stat sb;
+  return ::stat(p.c_str(), &sb) == 0;
+}
+
+uint32_t reconstruct_steps(const SearchView& R, NodeId s, NodeId g, int W) {
+  const NodeId INVALID = SearchWorkspace::INVALID;
+  if (R.dist(g) == Key::INF) return 0;
+  uint32_t steps = 0;
+  NodeId v = g;
+  while (v != INVALID && v != s) {
+    const NodeId p = R.parent(v);
+    if (p == INVALID) return 0;
+    const int dx = std::abs((int)(v % (NodeId)W) - (int)(p % (NodeId)W));
+    const int dy = std::abs((int)(v / (NodeId)W) - (int)(p / (NodeId)W));
+    steps += (uint32_t)(dx > dy ? dx : dy);
+    v = p;
+  }
+  return steps;
+}
+
+// scen opt = a + b·√2 (a: 직선 칸 수, b: 대각 칸 수) 를 정수 a, b 로 분해해 10a + 14b 반환
+// √2 가 무리수라 분해는 유일 → b 를 훑어 a 가 정수에 가장 가까운 것을 고름
+// (opt 는 소수 8자리 정도로 기록되므로 1e-4 안쪽이 아니면 분해 실패로 false)
+bool opt_bound_10_14(double opt, uint64_t& bound) {
+  const double r2 = std::sqrt(2.0);
+  double best_err = 1e-4;
+  bool found = false;
+  for (uint64_t b = 0; (double)b * r2 <= opt + 1e-4; ++b) {
+    const double a = opt - (double)b * r2;
+    const double err = std::fabs(a - std::round(a));
+    if (err < best_err) {
+      best_err = err;
+      bound = 10 * (uint64_t)std::llround(std::max(a, 0.0)) + 14 * b;
+      found = true;
+    }
+  }
+  return found;
+}
+
+uint64_t pq_ops(const PQMetrics& m) {
+  return m.pushes + m.pops + m.decreases + m.moves + m.scans;
+}
+
+// 기대값 파일: 기계와 무관한 부분만 (케이스별 dist + 큐 연산 수)
+//   # map=.. scen=.. pq=.. engine=.. counters=0|1
+//   case,sx,sy,gx,gy,dist,pushes,pops,decreases,moves,scans
+// counters=0 (계측 꺼진 큐로 기록) 이면 연산 수 열은 비어 있음
+bool write_expected(const std::string& path, const BenchRun& R, bool counted) {
+  std::FILE* f = std::fopen(path.c_str(), "w");
+  if (!f) return false;
+  std::fprintf(f, "# map=%s scen=%s pq=%s engine=%s counters=%d\n",
+               R.map.c_str(), R.scen.c_str(), R.pq.c_str(), R.engine.c_str(), counted ? 1 : 0);
+  std::fprintf(f, "case,sx,sy,gx,gy,dist,pushes,pops,decreases,moves,scans\n");
+  for (const auto& c : R.cases) {
+    std::fprintf(f, "%d,%d,%d,%d,%d,%u", c.id, c.sx, c.sy, c.gx, c.gy, c.dist);
+    if (counted)
+      std::fprintf(f, ",%llu,%llu,%llu,%llu,%llu\n",
+                   (unsigned long long)c.pq.pushes, (unsigned long long)c.pq.pops,
+                   (unsigned long long)c.pq.decreases, (unsigned long long)c.pq.moves,
+                   (unsigned long long)c.pq.scans);
+    else
+      std::fprintf(f, ",,,,,\n");
+  }
+  const bool ok = (std::ferror(f) == 0);
+  std::fclose(f);
+  return ok;
+}
+
+// 실패 시 예외
+std::vector<BenchCase> load_expected(const std::string& path, bool& counted) {
+  std::ifstream ifs(path);
+  if (!ifs) throw std::runtime_error("cannot open " + path);
+  std::vector<BenchCase> out;
+  std::string line;
+  bool header = false;
+  counted = false;
+  while (std::getline(ifs, line)) {
+    if (line.empty()) continue;
+    if (line[0] == '#') {
+      counted = line.find(" counters=1") != std::string::npos;
+      continue;
+    }
+    if (!header) { header = true; continue; }
+    std::vector<std::string> f = split_list(line);
+    // split_list 는 빈 항목을 버리므로 counters=0 이면 6열
+    if (f.size() != (counted ? 11u : 6u)) throw std::runtime_error(path + ": bad row: " + line);
+    BenchCase c;
+    c.id = std::atoi(f[0].c_str());
+    c.sx = std::atoi(f[1].c_str()); c.sy = std::atoi(f[2].c_str());
+    c.gx = std::atoi(f[3].c_str()); c.gy = std::atoi(f[4].c_str());
+    c.dist = (uint32_t)std::strtoul(f[5].c_str(), nullptr, 10);
+    if (counted) {
+      c.pq.pushes    = std::strtoull(f[6].c_str(), nullptr, 10);
+      c.pq.pops      = std::strtoull(f[7].c_str(), nullptr, 10);
+      c.pq.decreases = std::strtoull(f[8].c_str(), nullptr, 10);
+      c.pq.moves     = std::strtoull(f[9].c_str(), nullptr, 10);
+      c.pq.scans     = std::strtoull(f[10].c_str(), nullptr, 10);
+    }
+    out.push_back(c);
+  }
+  return out;
+}
+
+// 전체 판정: Wilcoxon 유의 + 기하평균 비가 threshold 이상 느림
+bool perf_regressed(const CompareResult& cr, const CompareOptions& o) {
+  return cr.p < o.alpha && cr.z > 0.0 && cr.geomean_ratio > 1.0 + o.threshold;
+}
+
+// 케이스 하나: warmup + reps 회, 시간 요약 + 마지막 실행의 dist/메트릭
+BenchCase time_case(const GridMap& G, Engine engine, IPQ& pq, SearchWorkspace& ws,
+                    const JumpTable* jt, const LandmarkTable* lt,
+                    const ScenCase& c, int id, uint32_t warmup, uint32_t reps) {
+  using clock = std::chrono::steady_clock;
+  const NodeId s = node_from_xy(c.sx, c.sy, G.width());
+  const NodeId g = node_from_xy(c.gx, c.gy, G.width());
+  BenchCase bc;
+  bc.id = id; bc.sx = c.sx; bc.sy = c.sy; bc.gx = c.gx; bc.gy = c.gy;
+  bc.reps = reps;
+  std::vector<double> samples;
+  samples.reserve(reps);
+  for (uint32_t k = 0; k < warmup + reps; ++k) {
+    pq.reset_metrics();
+    const auto t0 = clock::now();
+    SearchView R = run_engine(engine, G, s, g, pq, ws, jt, lt);
+    const auto t1 = clock::now();
+    if (k >= warmup)
+      samples.push_back((double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+    if (k + 1 == warmup + reps) {
+      bc.dist = R.dist(g);
+      bc.steps = reconstruct_steps(R, s, g, G.width());
+      bc.pq = R.pq;
+      bc.algo = R.algo;
+    }
+  }
+  const SampleStats st = summarize(samples);
+  bc.min_ns = st.min; bc.median_ns = st.median; bc.mean_ns = st.mean;
+  bc.stddev_ns = st.stddev; bc.p90_ns = st.p90; bc.max_ns = st.max;
+  return bc;
+}
+
+// --worker <map> <scen> <pq> <stoc_block> <engine> <reps> <warmup>
+// stdin 으로 케이스 번호를 한 줄씩 받아 잰 결과를 한 줄로 돌려줌 (--baseline-bin 비교용)
+//   <dist> <median_ns> <mean_ns> <stddev_ns> <min_ns>
+int run_worker(const std::vector<std::string>& a) {
+  Engine engine;
+  if (a.size() != 7 || !parse_engine(a[4], engine)) {
+    std::fprintf(stderr, "bench_regress --worker: bad arguments\n");
+    return 1;
+  }
+  GridMap G(a[0], true);
+  JumpTable jt;
+  LandmarkTable lt;
+  if (engine == Engine::JPSPlus) jt = JumpTable::load_or_build(G, a[0]);
+  if (engine == Engine::ALT) lt = LandmarkTable::load_or_build(G, a[0], 16, LandmarkSelect::Farthest);
+  const std::vector<ScenCase> S = load_scen(a[1]);
+  auto pq = make_pq(a[2], (uint32_t)std::strtoul(a[3].c_str(), nullptr, 10), engine_bucket_width(engine, G));
+  const uint32_t reps = (uint32_t)std::strtoul(a[5].c_str(), nullptr, 10);
+  const uint32_t warmup = (uint32_t)std::strtoul(a[6].c_str(), nullptr, 10);
+  SearchWorkspace ws;
+  char line[64];
+  while (std::fgets(line, sizeof(line), stdin)) {
+    const int i = std::atoi(line);
+    if (i < 0 || i >= (int)S.size()) return 1;
+    const BenchCase bc = time_case(G, engine, *pq, ws, &jt, &lt, S[i], i, warmup, reps);
+    std::printf("%u %.1f %.1f %.1f %.1f\n", bc.dist, bc.median_ns, bc.mean_ns, bc.stddev_ns, bc.min_ns);
+    std::fflush(stdout);
+  }
+  return 0;
+}
+
+// run_worker 를 자식 프로세스로 띄워 파이프로 케이스를 하나씩 요청. 실패 시 예외
+class Worker {
+public:
+  Worker(const std::string& exe, const std::vector<std::string>& args) : exe_(exe) {
+    int in[2], out[2];
+    if (::pipe(in) != 0) throw std::runtime_error("pipe() failed");
+    if (::pipe(out) != 0) { ::close(in[0]); ::close(in[1]); throw std::runtime_error("pipe() failed"); }
+    pid_ = ::fork();
+    if (pid_ < 0) {
+      for (int fd : {in[0], in[1], out[0], out[1]}) ::close(fd);
+      throw std::runtime_error("fork() failed");
+    }
+    if (pid_ == 0) {
+      ::dup2(in[0], 0);
+      ::dup2(out[1], 1);
+      for (int fd : {in[0], in[1], out[0], out[1]}) ::close(fd);
+      std::vector<char*> argv;
+      argv.push_back(const_cast<char*>(exe.c_str()));
+      argv.push_back(const_cast<char*>("--worker"));
+      for (const auto& s : args) argv.push_back(const_cast<char*>(s.c_str()));
+      argv.push_back(nullptr);
+      ::execv(exe.c_str(), argv.data());
+      ::_exit(127);
+    }
+    ::close(in[0]);
+    ::close(out[1]);
+    to_ = ::fdopen(in[1], "w");
+    from_ = ::fdopen(out[0], "r");
+  }
+  ~Worker() {
+    if (to_) std::fclose(to_);   // EOF → 워커 종료
+    if (from_) std::fclose(from_);
+    if (pid_ > 0) ::waitpid(pid_, nullptr, 0);
+  }
+  Worker(const Worker&) = delete;
+  Worker& operator=(const Worker&) = delete;
+
+  BenchCase time_case(int i) {
+    BenchCase bc;
+    char line[256];
+    if (std::fprintf(to_, "%d\n", i) < 0 || std::fflush(to_) != 0 ||
+        !std::fgets(line, sizeof(line), from_) ||
+        std::sscanf(line, "%u %lf %lf %lf %lf", &bc.dist, &bc.median_ns, &bc.mean_ns,
+                    &bc.stddev_ns, &bc.min_ns) != 5)
+      throw std::runtime_error("worker " + exe_ + " failed on case " + std::to_string(i));
+    bc.id = i;
+    return bc;
+  }
+
+private:
+  std::string exe_;
+  pid_t pid_ = -1;
+  std::FILE* to_ = nullptr;
+  std::FILE* from_ = nullptr;
+};
+
+// 기준 바이너리(--baseline-bin)와 현재 바이너리를 워커로 띄워 케이스마다 번갈아 잼
+// (짝수 케이스는 기준 먼저, 홀수는 후보 먼저). 두 쪽이 같은 시점의 기계 상태를 겪으므로
+// 따로 잰 기준 파일과 달리 드리프트(주파수, 이웃 부하)가 비교에 섞이지 않음
+void measure_ab(const std::string& base_exe, const RunSpec& r, const RegressConfig& C,
+                const std::vector<ScenCase>& S, int cases, BenchRun& base, BenchRun& cand) {
+  const std::vector<std::string> args = {r.map, r.scen, r.pq, std::to_string(r.stoc_block), r.engine,
+                                         std::to_string(C.reps), std::to_string(C.warmup)};
+  Worker B(base_exe, args), A("/proc/self/exe", args);
+  base.reps = cand.reps = C.reps;
+  for (int i = 0; i < cases; ++i) {
+    BenchCase b, a;
+    if (i % 2 == 0) { b = B.time_case(i); a = A.time_case(i); }
+    else            { a = A.time_case(i); b = B.time_case(i); }
+    for (BenchCase* x : {&b, &a}) {
+      x->sx = S[i].sx; x->sy = S[i].sy; x->gx = S[i].gx; x->gy = S[i].gy;
+      x->reps = C.reps;
+    }
+    base.cases.push_back(b);
+    cand.cases.push_back(a);
+  }
+}
+
+// 맵/scen/기준 dist 는 같은 파일을 쓰는 조합끼리 공유
+struct MapData {
+  std::unique_ptr<GridMap> G;
+  JumpTable jt;
+  LandmarkTable lt;
+  bool jt_ready = false, lt_ready = false;
+};
+
+struct ScenData {
+  std::vector<ScenCase> S;
+  std::vector<Cost32> ref;   // Dijkstra(heap) dist, 필요한 앞부분만 계산
+};
+
+} // namespace
+
+// 맵 × scen × 큐 × 엔진 조합을 돌려 정확성(scen opt + 기준 Dijkstra)과
+// 저장된 기준 결과 대비 시간/큐 연산 수를 검사, 실패가 있으면 exit 1
+int main(int argc, char** argv) {
+  if (argc > 1 && std::string(argv[1]) == "--worker")
+    return run_worker(std::vector<std::string>(argv + 2, argv + argc));
+  std::vector<std::string> pos;
+  bool update = false;
+  std::string only;
+  std::string base_bin;   // 기준 커밋으로 빌드한 bench_regress (시간 판정용)
+  double threshold = -1.0;
+  for (int i = 1; i < argc; ++i) {
+    std::string a = argv[i];
+    if      (a == "--update")                   update = true;
+    else if (a.rfind("--baseline-bin=", 0) == 0) base_bin = a.substr(15);
+    else if (a.rfind("--only=", 0) == 0)        only = a.substr(7);
+    else if (a.rfind("--threshold=", 0) == 0)   threshold = std::strtod(a.c_str() + 12, nullptr);
+    else pos.push_back(a);
+  }
+  if (pos.size() != 1) {
+    std::fprintf(stderr,
+      "usage: bench_regress <config> [--update] [--only=<substr>] [--threshold=X] [--baseline-bin=<exe>]\n"
+      "  expected 파일(dist + 큐 연산 수, 커밋)이 없으면 실패\n"
+      "  시간: --baseline-bin(기준 커밋의 bench_regress)과 케이스마다 번갈아 재서 판정,\n"
+      "        없으면 logs/baselines 의 기계별 기준과 비교해 PERF_SUSPECT 로 알리기만 함 (실패 아님)\n"
+      "  --update: expected 와 시간 기준을 현재 결과로 기록/교체 (정확한 결과만)\n");
+    return 1;
+  }
+
+  RegressConfig C;
+  try {
+    C = load_config(pos[0]);
+  } catch (const std::exception& e) {
+    std::fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+  if (threshold >= 0.0) C.cmp.threshold = threshold;
+  if (!base_bin.empty()) std::signal(SIGPIPE, SIG_IGN);   // 워커가 죽으면 쓰기 오류로 받음
+
+  std::map<std::string, MapData> maps;
+  std::map<std::string, ScenData> scens;   // key = map + '|' + scen
+  SearchWorkspace ws;
+  using clock = std::chrono::steady_clock;
+
+  int n_run = 0, n_correct_fail = 0, n_perf_fail = 0, n_metric_fail = 0;
+  int n_metric_skip = 0, n_perf_skip = 0, n_perf_suspect = 0, n_new = 0;
+  for (const RunSpec& r : C.runs) {
+    if (!only.empty() && run_file("", r).find(only) == std::string::npos) continue;
+    Engine engine;
+    if (!parse_engine(r.engine, engine)) {
+      std::fprintf(stderr, "unknown engine: %s\n", r.engine.c_str());
+      return 1;
+    }
+    ++n_run;
+
+    MapData& M = maps[r.map];
+    if (!M.G) M.G = std::make_unique<GridMap>(r.map, true);
+    const GridMap& G = *M.G;
+    if (engine == Engine::JPSPlus && !M.jt_ready) { M.jt = JumpTable::load_or_build(G, r.map); M.jt_ready = true; }
+    if (engine == Engine::ALT && !M.lt_ready) {
+      M.lt = LandmarkTable::load_or_build(G, r.map, 16, LandmarkSelect::Farthest);
+      M.lt_ready = true;
+    }
+
+    ScenData& SD = scens[r.map + "|" + r.scen];
+    if (SD.S.empty()) SD.S = load_scen(r.scen);
+    const int cases = (r.cases <= 0 || r.cases > (int)SD.S.size()) ? (int)SD.S.size() : r.cases;
+    if ((int)SD.ref.size() < cases) {
+      HeapPQ H;
+      for (int i = (int)SD.ref.size(); i < cases; ++i) {
+        const ScenCase& c = SD.S[i];
+        const NodeId g = node_from_xy(c.gx, c.gy, G.width());
+        SD.ref.push_back(dijkstra_single(G, node_from_xy(c.sx, c.sy, G.width()), H, ws).dist(g));
+      }
+    }
+
+    // 측정: 케이스마다 warmup + reps 회, 메트릭은 마지막 실행
+    auto pq = make_pq(r.pq, r.stoc_block, engine_bucket_width(engine, G));
+    const bool counted = pq->counts_metrics();   // @off 큐나 PATHLAB_METRICS=off 빌드면 false
+    BenchRun run;
+    run.map = r.map; run.scen = r.scen; run.pq = r.pq; run.engine = r.engine;
+    run.reps = C.reps; run.warmup = C.warmup;
+    run.cases.reserve((std::size_t)cases);
+    int bad_ref = 0, bad_opt = 0;
+    for (int i = 0; i < cases; ++i) {
+      const ScenCase& c = SD.S[i];
+      const BenchCase bc = time_case(G, engine, *pq, ws, &M.jt, &M.lt, c, i, C.warmup, C.reps);
+
+      // 정확성: 기준 Dijkstra 와 같아야 함
+      // scen opt(√2 대각, 코너 통과 금지) 를 a + b√2 로 분해해 10a + 14b 이하여야 함
+      // (scen 의 최적 경로는 GridMap 에서도 유효하고 비용이 10a + 14b. GridMap 은 코너
+      //  통과를 허용하므로 더 짧을 수는 있어도 길 수는 없음 → 상한)
+      if (bc.dist != SD.ref[i]) {
+        if (bad_ref++ < 5)
+          std::printf("    case=%d dist=%u ref=%u\n", i, bc.dist, SD.ref[i]);
+      }
+      const bool reachable = bc.dist != Key::INF;
+      uint64_t bound = 0;
+      if (c.opt > 0.0 && !opt_bound_10_14(c.opt, bound)) {
+        if (bad_opt++ < 5)
+          std::printf("    case=%d opt=%.8f is not a + b*sqrt(2)\n", i, c.opt);
+      } else if (c.opt > 0.0 && (!reachable || bc.dist > bound)) {
+        if (bad_opt++ < 5)
+          std::printf("    case=%d dist=%u exceeds opt bound 10a+14b=%llu (opt=%.8f)\n",
+                      i, bc.dist, (unsigned long long)bound, c.opt);
+      }
+      run.cases.push_back(bc);
+    }
+
+    double total_ms = 0.0;
+    uint64_t ops = 0;
+    for (const auto& bc : run.cases) { total_ms += bc.median_ns / 1e6; ops += pq_ops(bc.pq); }
+
+    std::string verdict = "PASS";
+    std::string detail;
+    char buf[256];
+    const bool correct = (bad_ref == 0 && bad_opt == 0);
+    if (!correct) {
+      ++n_correct_fail;
+      verdict = "FAIL";
+      std::snprintf(buf, sizeof(buf), " wrong_dist=%d over_opt=%d", bad_ref, bad_opt);
+      detail += buf;
+    }
+
+    // 1) 기대값 (dist + 큐 연산 수, 기계와 무관): 저장소에 커밋된 expected 파일과 비교
+    //    파일이 없으면 실패 (--update 로만 생성)
+    const std::string exp_path = run_file(C.expected, r);
+    if (update) {
+      if (correct) {
+        ::mkdir(C.expected.c_str(), 0755);
+        if (!write_expected(exp_path, run, counted)) {
+          std::fprintf(stderr, "cannot write %s\n", exp_path.c_str());
+          return 1;
+        }
+        ++n_new;
+        detail += " expected written";
+      }
+    } else if (!file_exists(exp_path)) {
+      ++n_correct_fail;
+      verdict = "FAIL";
+      detail += " NO_EXPECTED_FILE (record with --update)";
+    } else {
+      try {
+        bool exp_counted = false;
+        const std::vector<BenchCase> exp = load_expected(exp_path, exp_counted);
+        std::map<int, const BenchCase*> by_id;
+        for (const auto& bc : exp) by_id[bc.id] = &bc;
+        std::size_t missing = 0, dist_diff = 0;
+        uint64_t exp_ops = 0, cand_ops = 0;
+        for (const auto& bc : run.cases) {
+          auto it = by_id.find(bc.id);
+          if (it == by_id.end()) { ++missing; continue; }
+          const BenchCase& e = *it->second;
+          if (e.dist != bc.dist || e.sx != bc.sx || e.sy != bc.sy || e.gx != bc.gx || e.gy != bc.gy)
+            ++dist_diff;
+          exp_ops  += pq_ops(it->second->pq);
+          cand_ops += pq_ops(bc.pq);
+        }
+        if (missing || dist_diff) {
+          if (correct) ++n_correct_fail;
+          verdict = "FAIL";
+          std::snprintf(buf, sizeof(buf), " EXPECTED_DIST_MISMATCH=%zu missing_cases=%zu",
+                        dist_diff, missing);
+          detail += buf;
+        }
+        // 큐 연산 수: 어느 쪽이든 카운터가 꺼져 있으면 비교할 수 없음 → 건너뜀으로 보고
+        if (counted && exp_counted) {
+          const double ops_ratio = exp_ops ? (double)cand_ops / (double)exp_ops : 1.0;
+          std::snprintf(buf, sizeof(buf), " pq_ops_ratio=%.4f", ops_ratio);
+          detail += buf;
+          if (ops_ratio > 1.0 + C.metrics_tol) {
+            ++n_metric_fail;
+            verdict = "FAIL";
+            detail += " PQ_OPS_REGRESSION";
+          }
+        } else {
+          ++n_metric_skip;
+          detail += counted ? " pq_ops=SKIPPED(expected has no counters)"
+                            : " pq_ops=SKIPPED(counters off)";
+        }
+      } catch (const std::exception& e) {
+        ++n_correct_fail;
+        verdict = "FAIL";
+        detail += std::string(" expected: ") + e.what();
+      }
+    }
+
+    // 2) 시간
+    //  - --baseline-bin: 기준 바이너리와 케이스마다 번갈아 잰 결과로 판정 (실패 가능)
+    //  - 그 외: 기계별 기준 파일(logs/baselines, 커밋 안 함)과 비교. 다른 프로세스·시점에 잰
+    //    값이라 같은 바이너리로 연달아 돌려도 기계 드리프트만으로 ±20% 가 나옴 → 판정하지 않고
+    //    PERF_SUSPECT 로 알리기만 함. 기준 파일이 없으면 건너뜀 (--update 로만 생성)
+    const std::string base_path = run_file(C.baselines, r);
+    if (update) {
+      if (correct) {
+        ::mkdir(C.baselines.c_str(), 0755);
+        if (!write_bench_csv(base_path, run)) {
+          std::fprintf(stderr, "cannot write %s\n", base_path.c_str());
+          return 1;
+        }
+        detail += " timing baseline written";
+      }
+    } else if (!base_bin.empty()) {
+      try {
+        BenchRun ab_base, ab_cand;
+        measure_ab(base_bin, r, C, SD.S, cases, ab_base, ab_cand);
+        const CompareResult cr = compare_bench(ab_base, ab_cand, C.cmp);
+        if (!cr.error.empty()) throw std::runtime_error(cr.error);
+        std::snprintf(buf, sizeof(buf), " ab_time_ratio=%.3f p=%.3g slower_cases=%zu",
+                      cr.geomean_ratio, cr.p, cr.regressions);
+        detail += buf;
+        if (perf_regressed(cr, C.cmp)) {
+          ++n_perf_fail;
+          verdict = "FAIL";
+          detail += " PERF_REGRESSION";
+        }
+      } catch (const std::exception& e) {
+        ++n_perf_fail;
+        verdict = "FAIL";
+        detail += std::string(" baseline-bin: ") + e.what();
+      }
+    } else if (!file_exists(base_path)) {
+      ++n_perf_skip;
+      detail += " perf=SKIPPED(no timing baseline)";
+    } else {
+      try {
+        const BenchRun base = load_bench_csv(base_path);
+        const CompareResult cr = compare_bench(base, run, C.cmp);
+        if (!cr.error.empty()) throw std::runtime_error(cr.error);
+        std::snprintf(buf, sizeof(buf), " time_ratio=%.3f p=%.3g slower_cases=%zu",
+                      cr.geomean_ratio, cr.p, cr.regressions);
+        detail += buf;
+        if (perf_regressed(cr, C.cmp)) {
+          ++n_perf_suspect;
+          detail += " PERF_SUSPECT(confirm with --baseline-bin)";
+        }
+      } catch (const std::exception& e) {
+        ++n_perf_skip;
+        detail += std::string(" perf=SKIPPED(baseline: ") + e.what() + ")";
+      }
+    }
+
+    std::printf("[%s] %s %s pq=%s engine=%s cases=%d time=%.3fms pq_ops=%s%s\n",
+                verdict.c_str(), stem(r.map).c_str(), stem(r.scen).c_str(),
+                run.pq.c_str(), r.engine.c_str(), cases, total_ms,
+                counted ? std::to_string(ops).c_str() : "off", detail.c_str());
+    std::fflush(stdout);
+  }
+
+  const bool fail = n_correct_fail || n_perf_fail || n_metric_fail;
+  std::printf("RESULT: %s (%d runs, %d correctness, %d perf, %d pq-metric failures; "
+              "%d perf suspect; skipped %d perf, %d pq-metric checks; %d expected files written)\n",
+              fail ? "FAIL" : "PASS", n_run, n_correct_fail, n_perf_fail, n_metric_fail,
+              n_perf_suspect, n_perf_skip, n_metric_skip, n_new);
+  return fail ? 1 : 0;
+}
@@ -4,41 +4,42 @@
 #include <memory>
 #include <chrono>
 #include <limits>
+#include <vector>
+#include <algorithm>
 
 #include "pathlab/core/grid_map.hpp"
 #include "pathlab/io/scen_loader.hpp"
 #include "pathlab/queues/ipq.hpp"
-#include "pathlab/queues/heap_pq.hpp"
-#include "pathlab/queues/stoc_pq.hpp"
+#include "pathlab/queues/pq_factory.hpp"
+#include "pathlab/queues/pq_profile.hpp"
 #include "pathlab/ll/dijkstra.hpp"
-#include "pathlab/queues/bucket_pq.hpp"  // <-- bucket PQ
+#include "pathlab/ll/engine.hpp"
+#include "pathlab/ll/jps.hpp"
+#include "pathlab/ll/bidir.hpp"
+#include "pathlab/ll/ch.hpp"
+#include "pathlab/ll/alt.hpp"
+#include "pathlab/queues/pq_trace.hpp"
+#include "pathlab/io/bench_report.hpp"
+#include "pathlab/util/stats.hpp"
+#include "pathlab/util/perf_counters.hpp"
+#include "pathlab/util/metrics_policy.hpp"
 
 using namespace pathlab;
 
-// allow_diag 여부에 따라 W(최대 가중치) 결정: 10/14 스케일 가정
-static std::unique_ptr<IPQ> make_pq(const std::string& name,
-                                    uint32_t stoc_block,
-                                    bool allow_diag) {
-  if (name == "heap")   return std::make_unique<HeapPQ>();
-  if (name == "stoc")   return std::make_unique<STOCPQ>(stoc_block);
-  if (name == "bucket") {
-    uint32_t W = allow_diag ? 14u : 10u;
-    return std::make_unique<BucketPQ>(W);
-  }
-  // 기본은 heap
-  return std::make_unique<HeapPQ>();
-}
-
 // parent를 따라가 “칸 수(=이동 횟수)” 계산
-static uint32_t reconstruct_steps(const DijkstraResult& R, NodeId s, NodeId g) {
-  const NodeId INVALID = std::numeric_limits<NodeId>::max();
-  if (R.dist.empty()) return 0;
-  if (R.dist[g] == Key::INF) return 0;   // 도달 불가
+// (JPS 의 parent 는 jump point 사이를 이으므로 구간마다 max(|dx|,|dy|) 칸)
+static uint32_t reconstruct_steps(const SearchView& R, NodeId s, NodeId g, int W) {
+  const NodeId INVALID = SearchWorkspace::INVALID;
+  if (R.dist(g) == Key::INF) return 0;   // 도달 불가
   uint32_t steps = 0;
   NodeId v = g;
   while (v != INVALID && v != s) {
-    v = R.parent[v];
-    ++steps;
+    const NodeId p = R.parent(v);
+    if (p == INVALID) { v = p; break; }
+    const int dx = std::abs((int)(v % (NodeId)W) - (int)(p % (NodeId)W));
+    const int dy = std::abs((int)(v / (NodeId)W) - (int)(p / (NodeId)W));
+    steps += (uint32_t)(dx > dy ? dx : dy);
+    v = p;
   }
   if (v == INVALID) return 0;            // 예외: 부모 끊김
   return steps;                          // 경로 셀 개수 - 1
@@ -56,65 +57,397 @@ static inline void split_steps_10_14(uint32_t steps, uint32_t dist,
   straight = steps - diag;
 }
 
+// " | hw cycles=.. instr=.. ipc=.. ..." (열리지 않은 카운터는 '-')
+static void print_hw(const HwCounts& c) {
+  std::printf(" | hw");
+  for (int i = 0; i < kNumHwEvents; ++i) {
+    const HwEvent e = (HwEvent)i;
+    if (c.has(e)) std::printf(" %s=%llu", hw_event_name(e), (unsigned long long)c[e]);
+    else          std::printf(" %s=-", hw_event_name(e));
+    if (e == HwEvent::Instructions) {
+      if (c.has(HwEvent::Cycles) && c.has(e) && c[HwEvent::Cycles] > 0)
+        std::printf(" ipc=%.2f", (double)c[e] / (double)c[HwEvent::Cycles]);
+      else
+        std::printf(" ipc=-");
+    }
+  }
+}
+
+// 값은 bin 하한 (16 이상은 2의 거듭제곱 구간)
+static void print_hist(const char* name, const Histogram& h) {
+  std::printf("HIST %s: n=%llu mean=%.2f p50=%llu p90=%llu p99=%llu max=%llu\n", name,
+              (unsigned long long)h.count, h.mean(),
+              (unsigned long long)h.percentile(0.5), (unsigned long long)h.percentile(0.9),
+              (unsigned long long)h.percentile(0.99), (unsigned long long)h.max);
+}
+
+// --compare: 두 CSV 결과를 비교해 회귀가 있으면 1 반환
+static int run_compare(const std::string& base_path, const std::string& cand_path,
+                       const CompareOptions& opt) {
+  const BenchRun A = load_bench_csv(base_path);
+  const BenchRun B = load_bench_csv(cand_path);
+  const CompareResult C = compare_bench(A, B, opt);
+  std::printf("compare base=%s (pq=%s engine=%s) cand=%s (pq=%s engine=%s)\n",
+              base_path.c_str(), A.pq.c_str(), A.engine.c_str(),
+              cand_path.c_str(), B.pq.c_str(), B.engine.c_str());
+  if (!C.error.empty()) {
+    std::printf("RESULT: ERROR %s\n", C.error.c_str());
+    return 1;
+  }
+  std::printf("cases=%zu geomean=%.4fx wilcoxon z=%.2f p=%.3g (alpha=%.3g threshold=%.1f%%)\n",
+              C.cases.size(), C.geomean_ratio, C.z, C.p, opt.alpha, opt.threshold * 100.0);
+  std::printf("regressions=%zu improvements=%zu dist_mismatch=%zu\n",
+              C.regressions, C.improvements, C.dist_mismatches);
+
+  // 회귀 케이스는 느려진 순으로 최대 20개
+  std::vector<const CaseDelta*> bad;
+  for (const auto& d : C.cases) if (d.regression || d.dist_mismatch) bad.push_back(&d);
+  std::sort(bad.begin(), bad.end(), [](const CaseDelta* x, const CaseDelta* y) { return x->ratio > y->ratio; });
+  for (std::size_t i = 0; i < bad.size() && i < 20; ++i)
+    std::printf("  case=%d base=%.0fns cand=%.0fns ratio=%.3f p=%.3g%s%s\n",
+                bad[i]->id, bad[i]->base_ns, bad[i]->cand_ns, bad[i]->ratio, bad[i]->p,
+                bad[i]->regression ? " REGRESSION" : "", bad[i]->dist_mismatch ? " DIST_MISMATCH" : "");
+  std::printf("RESULT: %s\n", C.regression ? "REGRESSION" : "OK");
+  return C.regression ? 1 : 0;
+}
+
 int main(int argc, char** argv) {
-  if (argc < 5) {
+  // 위치 인자 + "--key=value" 옵션
+  std::vector<std::string> pos;
+  std::string engine_str = "dijkstra";
+  unsigned threads = 0;   // CH/ALT 전처리 스레드 (0 = nproc)
+  uint32_t landmarks = 16;
+  std::string select_str = "farthest";
+  bool perf = false;      // perf_event_open 카운터
+  bool hist = false;      // 분포 히스토그램 (큐는 pq@detailed 일 때만)
+  std::string trace_path; // 큐 연산 트레이스 (pq_replay 입력)
+  uint32_t warmup = 0, reps = 1;     // 케이스별 워밍업/측정 반복
+  std::string csv_path, json_path;
+  bool compare = false;
+  CompareOptions cmp;
+  for (int i = 1; i < argc; ++i) {
+    std::string a = argv[i];
+    if      (a.rfind("--engine=", 0) == 0)  engine_str = a.substr(9);
+    else if (a.rfind("--threads=", 0) == 0) threads = (unsigned)std::strtoul(a.c_str() + 10, nullptr, 10);
+    else if (a.rfind("--landmarks=", 0) == 0) landmarks = (uint32_t)std::strtoul(a.c_str() + 12, nullptr, 10);
+    else if (a.rfind("--select=", 0) == 0)  select_str = a.substr(9);
+    else if (a == "--perf")                 perf = true;
+    else if (a == "--hist")                 hist = true;
+    else if (a.rfind("--trace=", 0) == 0)   trace_path = a.substr(8);
+    else if (a.rfind("--warmup=", 0) == 0)  warmup = (uint32_t)std::strtoul(a.c_str() + 9, nullptr, 10);
+    else if (a.rfind("--reps=", 0) == 0)    reps = (uint32_t)std::strtoul(a.c_str() + 7, nullptr, 10);
+    else if (a.rfind("--csv=", 0) == 0)     csv_path = a.substr(6);
+    else if (a.rfind("--json=", 0) == 0)    json_path = a.substr(7);
+    else if (a == "--compare")              compare = true;
+    else if (a.rfind("--alpha=", 0) == 0)   cmp.alpha = std::strtod(a.c_str() + 8, nullptr);
+    else if (a.rfind("--threshold=", 0) == 0) cmp.threshold = std::strtod(a.c_str() + 12, nullptr);
+    else pos.push_back(a);
+  }
+  if (compare) {
+    if (pos.size() != 2) {
+      std::fprintf(stderr, "usage: bench_single --compare <base.csv> <cand.csv> [--alpha=0.01] [--threshold=0.05]\n");
+      return 1;
+    }
+    return run_compare(pos[0], pos[1], cmp);
+  }
+  if (reps == 0) reps = 1;
+  // bidir/ch 는 큐/워크스페이스를 두 벌 쓰므로 Engine 밖에서 따로 처리
+  Engine engine = Engine::Dijkstra;
+  const bool bidir = (engine_str == "bidir");
+  const bool ch    = (engine_str == "ch");
+  const bool two_sided = bidir || ch;
+  LandmarkSelect select = LandmarkSelect::Farthest;
+  if (pos.size() < 4 || (!two_sided && !parse_engine(engine_str, engine)) ||
+      !parse_landmark_select(select_str, select)) {
     std::fprintf(stderr,
-      "usage: bench_single <map> <scen> <pq:heap|stoc|bucket> <cases>\n"
-      "       [allow_diag=1] [stoc_block=256]\n");
+      "usage: bench_single <map> <scen> <pq:heap|stoc[_radix|_net]|bucket|radix|dary{2,4,8}|lazy{2,4,8}|auto> <cases>\n"
+      "       [allow_diag=1] [stoc_block=0 (kernel default)] [--engine=dijkstra|dijkstra_t|astar|jps|jps+|alt|bidir|ch] [--threads=nproc]\n"
+      "       [--landmarks=16] [--select=farthest|avoid] [--perf] [--hist]\n"
+      "       [--trace=<file>] [--warmup=0] [--reps=1] [--csv=<file>] [--json=<file>]\n"
+      "       bench_single --compare <base.csv> <cand.csv> [--alpha=0.01] [--threshold=0.05]\n");
     return 1;
   }
-  std::string map_path  = argv[1];
-  std::string scen_path = argv[2];
-  std::string pq_name   = argv[3];
-  int cases = std::atoi(argv[4]);
-  int allow_diag = (argc > 5) ? std::atoi(argv[5]) : 1;
-  uint32_t stoc_block = (argc > 6) ? (uint32_t)std::strtoul(argv[6], nullptr, 10) : 256u;
+  std::string map_path  = pos[0];
+  std::string scen_path = pos[1];
+  std::string pq_name   = pos[2];
+  int cases = std::atoi(pos[3].c_str());
+  int allow_diag = (pos.size() > 4) ? std::atoi(pos[4].c_str()) : 1;
+  uint32_t stoc_block = (pos.size() > 5) ? (uint32_t)std::strtoul(pos[5].c_str(), nullptr, 10) : 0u;
 
   GridMap G(map_path, allow_diag != 0);
   auto S = load_scen(scen_path);
   if (cases <= 0 || cases > (int)S.size()) cases = (int)S.size();
 
-  auto pq = make_pq(pq_name, stoc_block, allow_diag != 0);
+  // pq=auto: pq_tune 이 남긴 <map>.pqprof 에서 엔진별 큐/블록 크기
+  if (pq_name == "auto") {
+    const bool prof = resolve_auto_pq(map_path, engine_str, graph_hash(G), pq_name, stoc_block);
+    std::fprintf(stderr, "pq auto -> %s block=%u (%s)\n", pq_name.c_str(), stoc_block,
+                 prof ? PQProfile::cache_path(map_path).c_str() : "no profile entry, default");
+  }
+
+  // --trace: 탐색이 쓰는 큐를 기록용 데코레이터로 감쌈 (단방향 엔진만)
+  // (pq_inner 를 먼저 선언 → 데코레이터가 먼저 소멸)
+  std::unique_ptr<IPQ> pq_inner;
+  std::unique_ptr<IPQ> pq = make_pq(pq_name, stoc_block, engine_bucket_width(engine, G));
+  if (!trace_path.empty()) {
+    if (two_sided) {
+      std::fprintf(stderr, "--trace is not supported with --engine=%s\n", engine_str.c_str());
+      return 1;
+    }
+    pq_inner = std::move(pq);
+    pq = std::make_unique<TracingPQ>(*pq_inner, trace_path);
+  }
+
+  JumpTable jt;
+  if (engine == Engine::JPSPlus) {
+    bool loaded = false;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    jt = JumpTable::load_or_build(G, map_path, &loaded);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    std::fprintf(stderr, "JPS+ table %s in %.3f ms (%s)\n",
+                 loaded ? "loaded" : "built",
+                 std::chrono::duration<double, std::milli>(t1 - t0).count(),
+                 JumpTable::cache_path(map_path).c_str());
+  }
 
-  uint64_t total_ms = 0;
+  // CH: 전처리(빌드 또는 캐시 로드)는 쿼리 시간과 따로 보고
+  CHGraph H;
+  if (ch) {
+    bool loaded = false;
+    CHBuildStats st;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    H = CHGraph::load_or_build(G, map_path, threads, &loaded, &st);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    const double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    if (loaded)
+      std::printf("CH preprocess: loaded in %.3f ms (%s) edges=%zu\n",
+                  ms, CHGraph::cache_path(map_path).c_str(), H.num_edges());
+    else
+      std::printf("CH preprocess: built in %.3f ms threads=%u rounds=%u shortcuts=%llu "
+                  "witness_settled=%llu edges=%zu\n",
+                  st.ms, st.threads, st.rounds,
+                  (unsigned long long)st.shortcuts,
+                  (unsigned long long)st.witness_settled, H.num_edges());
+  }
+
+  LandmarkTable lt;
+  if (engine == Engine::ALT) {
+    bool loaded = false;
+    ALTBuildStats st;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    lt = LandmarkTable::load_or_build(G, map_path, landmarks, select, threads, &loaded, &st);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    if (loaded)
+      std::fprintf(stderr, "ALT table loaded in %.3f ms (%s, K=%u %s)\n",
+                   std::chrono::duration<double, std::milli>(t1 - t0).count(),
+                   LandmarkTable::cache_path(map_path).c_str(),
+                   lt.num_landmarks(), landmark_select_name(select));
+    else
+      std::fprintf(stderr, "ALT table built: select %.3f ms + tables %.3f ms threads=%u (K=%u %s)\n",
+                   st.select_ms, st.table_ms, st.threads,
+                   lt.num_landmarks(), landmark_select_name(select));
+  }
+
+  SearchWorkspace ws(G.num_nodes());   // 모든 케이스가 공유
+
+  // bidir: 역방향 탐색용 큐/워크스페이스
+  std::unique_ptr<IPQ> pq_b;
+  SearchWorkspace ws_b;
+  if (two_sided) {
+    pq_b = make_pq(pq_name, stoc_block, engine_bucket_width(engine, G));
+    ws_b.begin(G.num_nodes());
+  }
+
+  // CH: 케이스마다 원본 그래프 Dijkstra(heap) dist 와 비교 (시간 측정 밖, allow_diag 무관)
+  std::unique_ptr<IPQ> ref_pq;
+  SearchWorkspace ref_ws;
+  uint64_t ch_mismatch = 0;
+  if (ch) {
+    ref_pq = make_pq("heap", 0, 0);
+    ref_ws.begin(G.num_nodes());
+  }
+
+  // 하드웨어 카운터는 탐색 구간(t0~t1)만 측정
+  std::unique_ptr<PerfCounters> hw;
+  if (perf) {
+    hw = std::make_unique<PerfCounters>();
+    if (!hw->available()) {
+      std::fprintf(stderr, "perf_event_open unavailable (check kernel.perf_event_paranoid); "
+                           "running without hw counters\n");
+      hw.reset();
+    } else {
+      std::fprintf(stderr, "hw counters: %s\n", hw->grouped() ? "event group" : "per-event (group not schedulable)");
+    }
+  }
+  HwCounts hw_total;
+
+  BenchRun run;
+  run.map = map_path; run.scen = scen_path; run.pq = pq_name; run.engine = engine_str;
+  run.reps = reps; run.warmup = warmup;
+  run.has_hw = (bool)hw;
+  run.cases.reserve((std::size_t)cases);
+
+  // 케이스마다 warmup 회 + reps 회 실행, 시간/카운터는 reps 표본만 사용
+  // (경로/메트릭은 마지막 실행 기준, 각 실행 결과는 동일)
+  using clock = std::chrono::steady_clock;
+  double total_ns = 0.0;
+  std::vector<double> samples;
+  PQHistograms pq_hist;
+  AlgoHistograms algo_hist;
+  bool have_pq_hist = false;
   for (int i=0;i<cases;++i) {
     const auto& c = S[i];
     const NodeId s = node_from_xy(c.sx, c.sy, G.width());
     const NodeId g = node_from_xy(c.gx, c.gy, G.width());
 
-    pq->reset_metrics();
-    auto t0 = std::chrono::high_resolution_clock::now();
-    DijkstraResult R = dijkstra_single(G, s, *pq);
-    auto t1 = std::chrono::high_resolution_clock::now();
-    uint64_t ms = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count();
-    total_ms += ms;
+    Cost32 dist = Key::INF;
+    uint32_t steps = 0;
+    DijkstraMetrics algo;
+    PQMetrics pqm;
+    HwCounts hc_sum;
+    samples.clear();
+    for (uint32_t r = 0; r < warmup + reps; ++r) {
+      const bool timed = (r >= warmup);
+      const bool last = (r + 1 == warmup + reps);
+      pq->reset_metrics();
+      if (pq_b) pq_b->reset_metrics();
+      HwCounts hc;
+      if (hw && timed) hw->start();
+      auto t0 = clock::now();
+      auto t1 = t0;
+      if (two_sided) {
+        BidirView B = ch ? ch_query(H, s, g, *pq, *pq_b, ws, ws_b)
+                         : bidir_single(G, s, g, *pq, *pq_b, ws, ws_b);
+        t1 = clock::now();
+        if (hw && timed) hc = hw->stop();
+        if (last) {
+          const auto P = ch ? H.unpack(B.path()) : B.path();
+          dist = B.dist;
+          steps = P.empty() ? 0u : (uint32_t)(P.size() - 1);
+          algo = B.algo;       // settled = 정방향 + 역방향
+          pqm = B.pq;
+        }
+      } else {
+        SearchView R = run_engine(engine, G, s, g, *pq, ws, &jt, &lt);
+        t1 = clock::now();
+        if (hw && timed) hc = hw->stop();
+        if (last) {
+          dist = R.dist(g);
+          steps = reconstruct_steps(R, s, g, G.width());
+          algo = R.algo;
+          pqm = R.pq;
+        }
+      }
+      if (timed) {
+        samples.push_back((double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        hc_sum += hc;
+      }
+    }
+    for (int e = 0; e < kNumHwEvents; ++e) hc_sum.v[e] /= reps;   // 반복 평균
+
+    if (ch) {
+      const Cost32 ref = dijkstra_multi(G, s, &g, 1, *ref_pq, ref_ws).dist(g);
+      if (ref != dist) {
+        if (ch_mismatch < 10)
+          std::fprintf(stderr, "CH MISMATCH case %d: ch=%u dijkstra=%u\n", i, dist, ref);
+        ++ch_mismatch;
+      }
+    }
+
+    // --hist: 큐 분포는 마지막 실행에서, 탐색 분포는 dijkstra 만 시간 측정 밖의 추가 실행 1회로
+    if (hist) {
+      for (IPQ* q : {pq.get(), pq_b.get()}) {
+        if (q && q->histograms()) { pq_hist += *q->histograms(); have_pq_hist = true; }
+      }
+      if (engine == Engine::Dijkstra && !two_sided)
+        dijkstra_single_m<MetricsLevel::Detailed>(G, s, *pq, ws, &algo_hist);
+    }
+
+    const SampleStats st = summarize(samples);
+    total_ns += st.median;
+    hw_total += hc_sum;
+
+    BenchCase bc;
+    bc.id = i;
+    bc.sx = c.sx; bc.sy = c.sy; bc.gx = c.gx; bc.gy = c.gy;
+    bc.dist = dist; bc.steps = steps; bc.reps = reps;
+    bc.min_ns = st.min; bc.median_ns = st.median; bc.mean_ns = st.mean;
+    bc.stddev_ns = st.stddev; bc.p90_ns = st.p90; bc.max_ns = st.max;
+    bc.pq = pqm; bc.algo = algo; bc.hw = hc_sum;
+    run.cases.push_back(bc);
 
-    const uint32_t steps = reconstruct_steps(R, s, g);
     uint32_t hv = 0, dg = 0;
-    split_steps_10_14(steps, (uint32_t)R.dist[g], hv, dg);
+    split_steps_10_14(steps, (uint32_t)dist, hv, dg);
 
     std::printf(
-      "case=%d start=(%d,%d) goal=(%d,%d) dist=%u steps=%u (H=%u,D=%u) time=%llums | "
+      "case=%d start=(%d,%d) goal=(%d,%d) dist=%u steps=%u (H=%u,D=%u) time=%lluns | "
       "PQ push=%llu pop=%llu dec=%llu scans=%llu moves=%llu | "
-      "algo relax=%llu improved=%llu settled=%llu\n",
+      "algo relax=%llu improved=%llu settled=%llu",
       i, c.sx, c.sy, c.gx, c.gy,
-      (unsigned)R.dist[g],
+      (unsigned)dist,
       (unsigned)steps, (unsigned)hv, (unsigned)dg,
-      (unsigned long long)ms,
-      (unsigned long long)R.pq.pushes,
-      (unsigned long long)R.pq.pops,       // expand ~= pop
-      (unsigned long long)R.pq.decreases,
-      (unsigned long long)R.pq.scans,
-      (unsigned long long)R.pq.moves,
-      (unsigned long long)R.algo.relaxations,
-      (unsigned long long)R.algo.improved,
-      (unsigned long long)R.algo.settled
+      (unsigned long long)st.median,      // reps > 1 이면 중앙값
+      (unsigned long long)pqm.pushes,
+      (unsigned long long)pqm.pops,       // expand ~= pop
+      (unsigned long long)pqm.decreases,
+      (unsigned long long)pqm.scans,
+      (unsigned long long)pqm.moves,
+      (unsigned long long)algo.relaxations,
+      (unsigned long long)algo.improved,
+      (unsigned long long)algo.settled
     );
+    if (reps > 1) std::printf(" | min=%.0fns sd=%.0fns", st.min, st.stddev);
+    if (hw) print_hw(hc_sum);
+    std::printf("\n");
   }
 
-  std::printf("TOTAL %d cases: %llums (avg %.3f ms/case)\n",
-              cases,
-              (unsigned long long)total_ms,
-              (cases>0)? (double)total_ms / (double)cases : 0.0);
-  return 0;
+  const double total_ms = total_ns / 1e6;
+  std::printf("TOTAL %d cases: %.3fms (avg %.3f us/case)\n",
+              cases, total_ms,
+              (cases>0)? total_ns / 1e3 / (double)cases : 0.0);
+  {
+    std::vector<double> med;
+    med.reserve(run.cases.size());
+    for (const auto& bc : run.cases) med.push_back(bc.median_ns);
+    const SampleStats st = summarize(std::move(med));
+    std::printf("STATS per-case median (ns): min=%.0f median=%.0f p90=%.0f p99=%.0f max=%.0f "
+                "mean=%.0f stddev=%.0f | reps=%u warmup=%u\n",
+                st.min, st.median, st.p90, st.p99, st.max, st.mean, st.stddev, reps, warmup);
+  }
+  if (hw) {
+    std::printf("HW TOTAL");
+    print_hw(hw_total);
+    std::printf("\n");
+  }
+  if (hist) {
+    if (have_pq_hist) {
+      // 큐 종류별로 해당하는 분포만 채워짐
+      if (pq_hist.sift_levels.count) print_hist("PQ sift_levels", pq_hist.sift_levels);
+      if (pq_hist.bucket_size.count) print_hist("PQ bucket_size", pq_hist.bucket_size);
+      if (pq_hist.block_size.count)  print_hist("PQ block_size", pq_hist.block_size);
+      std::printf("HIST PQ stale_pops=%llu\n", (unsigned long long)pq_hist.stale_pops);
+    } else {
+      std::printf("HIST PQ: none (use pq@detailed with heap|stoc*|bucket)\n");
+    }
+    if (engine == Engine::Dijkstra && !two_sided) {
+      print_hist("algo improved/expansion", algo_hist.improved_per_expansion);
+      print_hist("algo frontier", algo_hist.frontier);
+      std::printf("HIST algo stale_pops=%llu reexpanded=%llu\n",
+                  (unsigned long long)algo_hist.stale_pops, (unsigned long long)algo_hist.reexpanded);
+    }
+  }
+  if (ch)
+    std::printf("CH query: total=%.3fms avg=%.3fus/case dist_mismatch=%llu (vs dijkstra)\n",
+                total_ms, (cases>0)? total_ns / 1e3 / (double)cases : 0.0,
+                (unsigned long long)ch_mismatch);
+  if (!csv_path.empty() && !write_bench_csv(csv_path, run))
+    std::fprintf(stderr, "cannot write %s\n", csv_path.c_str());
+  if (!json_path.empty() && !write_bench_json(json_path, run))
+    std::fprintf(stderr, "cannot write %s\n", json_path.c_str());
+  if (auto* tr = dynamic_cast<TracingPQ*>(pq.get())) {
+    tr->finish();
+    std::fprintf(stderr, "PQ trace: %llu ops -> %s\n",
+                 (unsigned long long)tr->records(), trace_path.c_str());
+  }
+  return ch_mismatch ? 1 : 0;
 }
@@ -0,0 +1,89 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/io/scen_loader.hpp"
+#include "pathlab/queues/heap_pq.hpp"
+#include "pathlab/ll/dijkstra.hpp"
+#include "pathlab/ll/delta_stepping.hpp"
+
+using namespace pathlab;
+
+// 전체 SSSP 트리: 순차 dijkstra_single(heap) 대비 delta-stepping 스레드 스케일링
+int main(int argc, char** argv) {
+  std::vector<std::string> pos;
+  unsigned max_threads = std::thread::hardware_concurrency();
+  Cost32 delta = 14;
+  for (int i = 1; i < argc; ++i) {
+    std::string a = argv[i];
+    if      (a.rfind("--threads=", 0) == 0) max_threads = (unsigned)std::strtoul(a.c_str() + 10, nullptr, 10);
+    else if (a.rfind("--delta=", 0) == 0)   delta = (Cost32)std::strtoul(a.c_str() + 8, nullptr, 10);
+    else pos.push_back(a);
+  }
+  if (pos.size() < 3) {
+    std::fprintf(stderr,
+      "usage: bench_sssp <map> <scen> <sources> [allow_diag=1] [--delta=14] [--threads=nproc]\n");
+    return 1;
+  }
+  if (max_threads == 0) max_threads = 1;
+
+  GridMap G(pos[0], pos.size() > 3 ? std::atoi(pos[3].c_str()) != 0 : true);
+  auto S = load_scen(pos[1]);
+  int sources = std::atoi(pos[2].c_str());
+  if (sources <= 0 || sources > (int)S.size()) sources = (int)S.size();
+
+  using clock = std::chrono::steady_clock;
+  auto ms_since = [](clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(clock::now() - t0).count();
+  };
+
+  // 기준: 순차 Dijkstra
+  std::vector<std::vector<Cost32>> ref((std::size_t)sources);
+  HeapPQ pq;
+  double seq_ms = 0.0;
+  uint64_t seq_settled = 0;
+  for (int i = 0; i < sources; ++i) {
+    const NodeId s = node_from_xy(S[i].sx, S[i].sy, G.width());
+    auto t0 = clock::now();
+    DijkstraResult R = dijkstra_single(G, s, pq);
+    seq_ms += ms_since(t0);
+    seq_settled += R.algo.settled;
+    ref[i] = std::move(R.dist);
+  }
+  std::printf("dijkstra sources=%d time=%.3fms avg=%.3fms settled=%llu\n",
+              sources, seq_ms, seq_ms / sources, (unsigned long long)seq_settled);
+
+  DeltaOptions opt;
+  opt.delta = delta;
+  for (unsigned T = 1; T <= max_threads; ++T) {
+    opt.threads = T;
+    double ms = 0.0;
+    DijkstraMetrics am;
+    PQMetrics pm;
+    int mismatch = 0;
+    for (int i = 0; i < sources; ++i) {
+      const NodeId s = node_from_xy(S[i].sx, S[i].sy, G.width());
+      auto t0 = clock::now();
+      DijkstraResult R = delta_stepping(G, s, opt);
+      ms += ms_since(t0);
+      am += R.algo;
+      pm += R.pq;
+      if (R.dist != ref[i]) ++mismatch;
+    }
+    std::printf("delta=%u threads=%u time=%.3fms avg=%.3fms speedup=%.2f "
+                "| phases=%llu bucket_push=%llu | relax=%llu improved=%llu settled=%llu%s\n",
+                (unsigned)delta, T, ms, ms / sources,
+                ms > 0.0 ? seq_ms / ms : 0.0,
+                (unsigned long long)pm.scans,
+                (unsigned long long)pm.pushes,
+                (unsigned long long)am.relaxations,
+                (unsigned long long)am.improved,
+                (unsigned long long)am.settled,
+                mismatch ? " MISMATCH" : "");
+  }
+  return 0;
+}
@@ -0,0 +1,57 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include "pathlab/core/grid_map.hpp"
+
+using namespace pathlab;
+
+// MovingAI .map → .gmap (mmap 로더용 바이너리) 변환 + 검증
+int main(int argc, char** argv) {
+  std::vector<std::string> pos;
+  bool with_masks = true;
+  for (int i = 1; i < argc; ++i) {
+    std::string a = argv[i];
+    if (a == "--no-masks") with_masks = false;
+    else pos.push_back(a);
+  }
+  if (pos.size() < 2) {
+    std::fprintf(stderr, "usage: map_convert <in.map> <out.gmap> [--no-masks]\n");
+    return 1;
+  }
+
+  using clock = std::chrono::steady_clock;
+  auto ms_since = [](clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(clock::now() - t0).count();
+  };
+
+  auto t0 = clock::now();
+  GridMap src(pos[0], true);
+  const double parse_ms = ms_since(t0);
+  if (!src.save_binary(pos[1], with_masks)) {
+    std::fprintf(stderr, "cannot write %s\n", pos[1].c_str());
+    return 1;
+  }
+
+  t0 = clock::now();
+  GridMap dst(pos[1], true);
+  const double open_ms = ms_since(t0);
+
+  // 통행/이웃 마스크가 원본과 같은지 확인
+  if (dst.width() != src.width() || dst.height() != src.height()) {
+    std::fprintf(stderr, "verify failed: size mismatch\n");
+    return 1;
+  }
+  for (NodeId u = 0; u < (NodeId)src.num_nodes(); ++u) {
+    if (dst.neighbor_mask(u) != src.neighbor_mask(u)) {
+      std::fprintf(stderr, "verify failed at node %u\n", (unsigned)u);
+      return 1;
+    }
+  }
+
+  std::printf("%s -> %s: %dx%d masks=%s parse=%.3fms open=%.3fms\n",
+              pos[0].c_str(), pos[1].c_str(), src.width(), src.height(),
+              with_masks ? "yes" : "no", parse_ms, open_ms);
+  return 0;
+}
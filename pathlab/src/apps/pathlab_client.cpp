@@ -0,0 +1,253 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <unordered_map>
+#include <algorithm>
+#include <csignal>
+#include <stdexcept>
+#include <unistd.h>
+
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/io/scen_loader.hpp"
+#include "pathlab/queues/heap_pq.hpp"
+#include "pathlab/ll/engine.hpp"
+#include "pathlab/server/protocol.hpp"
+#include "pathlab/util/stats.hpp"
+
+using namespace pathlab;
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+struct ClientOptions {
+  std::string socket_path;
+  std::string map_path;
+  Engine   engine = Engine::AStar;
+  uint32_t batch = 1;       // 요청당 쿼리 수
+  uint32_t depth = 1;       // 연결당 동시에 보낸(응답 전) 요청 수
+  uint32_t requests = 0;    // 전체 요청 수 (0 = 케이스 수 / batch)
+  bool     want_path = false;
+};
+
+struct ConnResult {
+  std::vector<double> lat_us;   // 요청별 왕복 지연
+  std::vector<std::pair<uint32_t, Cost32>> dists;   // (케이스 번호, dist)
+  uint64_t queries = 0;
+  uint64_t path_nodes = 0;
+  uint64_t errors = 0;
+  std::string error;
+};
+
+uint32_t load_map(int fd, const std::string& path, MapInfoMsg& info) {
+  if (!write_frame(fd, MsgType::LoadMap, 0, path.data(), path.size()))
+    throw std::runtime_error("send LoadMap failed");
+  FrameHeader h;
+  std::vector<uint8_t> payload;
+  if (!read_frame(fd, h, payload)) throw std::runtime_error("connection closed");
+  if ((MsgType)h.type == MsgType::Error)
+    throw std::runtime_error("server: " + std::string(payload.begin(), payload.end()));
+  if ((MsgType)h.type != MsgType::MapInfo || payload.size() != sizeof(MapInfoMsg))
+    throw std::runtime_error("unexpected LoadMap reply");
+  std::memcpy(&info, payload.data(), sizeof(info));
+  return info.map_id;
+}
+
+// 연결 하나: depth 개까지 요청을 먼저 보내고, 응답이 끝날 때마다 다음 요청을 보냄 (closed loop)
+// 요청 번호는 모든 연결이 공유하는 카운터에서 받음
+void run_conn(const ClientOptions& opt, const std::vector<ScenCase>& S, uint32_t map_id,
+              std::atomic<uint32_t>& next_req, ConnResult& out) {
+  int fd = -1;
+  try {
+    fd = unix_connect(opt.socket_path);
+    struct Pending { clock_type::time_point t0; uint32_t base; };
+    std::unordered_map<uint32_t, Pending> inflight;
+    std::vector<uint8_t> buf;
+
+    auto send_next = [&]() -> bool {
+      const uint32_t r = next_req.fetch_add(1);
+      if (r >= opt.requests) return false;
+      const uint32_t base = (uint32_t)(((uint64_t)r * opt.batch) % S.size());
+      buf.clear();
+      append_pod(buf, QueryHeader{map_id, (uint8_t)opt.engine,
+                                  (uint8_t)(opt.want_path ? kQueryWantPath : 0), 0, opt.batch});
+      for (uint32_t k = 0; k < opt.batch; ++k) {
+        const ScenCase& c = S[(base + k) % S.size()];
+        append_pod(buf, QueryRec{(uint16_t)c.sx, (uint16_t)c.sy, (uint16_t)c.gx, (uint16_t)c.gy});
+      }
+      inflight[r] = Pending{clock_type::now(), base};
+      if (!write_frame(fd, MsgType::Query, r, buf.data(), buf.size()))
+        throw std::runtime_error("send Query failed");
+      return true;
+    };
+
+    for (uint32_t d = 0; d < opt.depth && send_next(); ++d) {}
+    FrameHeader h;
+    std::vector<uint8_t> payload;
+    while (!inflight.empty()) {
+      if (!read_frame(fd, h, payload)) throw std::runtime_error("connection closed");
+      auto it = inflight.find(h.req_id);
+      if (it == inflight.end()) throw std::runtime_error("reply for unknown request");
+      if ((MsgType)h.type == MsgType::Error) {
+        ++out.errors;
+        out.error.assign(payload.begin(), payload.end());
+        inflight.erase(it);
+        send_next();
+        continue;
+      }
+      if ((MsgType)h.type != MsgType::Result || payload.size() < sizeof(ResultHeader))
+        throw std::runtime_error("unexpected reply");
+      ResultHeader rh;
+      std::memcpy(&rh, payload.data(), sizeof(rh));
+      std::size_t off = sizeof(rh);
+      for (uint32_t k = 0; k < rh.count; ++k) {
+        uint32_t v[2];   // dist, npath
+        if (off + sizeof(v) > payload.size()) throw std::runtime_error("truncated result");
+        std::memcpy(v, payload.data() + off, sizeof(v));
+        off += sizeof(v) + (std::size_t)v[1] * sizeof(NodeId);
+        out.dists.emplace_back((uint32_t)((it->second.base + rh.first + k) % S.size()), v[0]);
+        out.path_nodes += v[1];
+      }
+      if (off != payload.size()) throw std::runtime_error("malformed result");
+      out.queries += rh.count;
+      if (h.flags & kFrameMore) continue;
+      out.lat_us.push_back(std::chrono::duration<double, std::micro>(
+                             clock_type::now() - it->second.t0).count());
+      inflight.erase(it);
+      send_next();
+    }
+  } catch (const std::exception& e) {
+    out.error = e.what();
+    ++out.errors;
+  }
+  if (fd >= 0) ::close(fd);
+}
+
+} // namespace
+
+// pathlab_server 부하 생성기: 연결 수 × 파이프라인 깊이로 요청을 보내고 왕복 지연 분포를 출력
+int main(int argc, char** argv) {
+  std::vector<std::string> pos;
+  ClientOptions opt;
+  std::string engine_str = "astar";
+  uint32_t conns = 1;
+  bool verify = false;
+  bool shutdown = false;
+  for (int i = 1; i < argc; ++i) {
+    std::string a = argv[i];
+    if      (a.rfind("--socket=", 0) == 0)   opt.socket_path = a.substr(9);
+    else if (a.rfind("--engine=", 0) == 0)   engine_str = a.substr(9);
+    else if (a.rfind("--conns=", 0) == 0)    conns = (uint32_t)std::strtoul(a.c_str() + 8, nullptr, 10);
+    else if (a.rfind("--depth=", 0) == 0)    opt.depth = (uint32_t)std::strtoul(a.c_str() + 8, nullptr, 10);
+    else if (a.rfind("--batch=", 0) == 0)    opt.batch = (uint32_t)std::strtoul(a.c_str() + 8, nullptr, 10);
+    else if (a.rfind("--requests=", 0) == 0) opt.requests = (uint32_t)std::strtoul(a.c_str() + 11, nullptr, 10);
+    else if (a == "--path")                  opt.want_path = true;
+    else if (a == "--verify")                verify = true;
+    else if (a == "--shutdown")              shutdown = true;
+    else pos.push_back(a);
+  }
+  if (opt.socket_path.empty() || (pos.size() < 2 && !(shutdown && pos.empty())) ||
+      !parse_engine(engine_str, opt.engine)) {
+    std::fprintf(stderr,
+      "usage: pathlab_client --socket=<path> <map> <scen> [--engine=astar|...] [--conns=1] [--depth=1]\n"
+      "       [--batch=1] [--requests=cases/batch] [--path] [--verify] [--shutdown]\n"
+      "       pathlab_client --socket=<path> --shutdown\n"
+      "  map 경로는 서버 기준 (서버가 아직 안 올린 맵이면 LoadMap 으로 올림)\n");
+    return 1;
+  }
+  std::signal(SIGPIPE, SIG_IGN);
+  if (conns == 0) conns = 1;
+  if (opt.depth == 0) opt.depth = 1;
+  if (opt.batch == 0) opt.batch = 1;
+
+  int rc = 0;
+  if (!pos.empty()) {
+    opt.map_path = pos[0];
+    const auto S = load_scen(pos[1]);
+    if (S.empty()) { std::fprintf(stderr, "empty scen: %s\n", pos[1].c_str()); return 1; }
+    if (opt.requests == 0) opt.requests = (uint32_t)((S.size() + opt.batch - 1) / opt.batch);
+
+    MapInfoMsg info;
+    try {
+      const int fd = unix_connect(opt.socket_path);
+      struct Closer { int fd; ~Closer() { ::close(fd); } } closer{fd};
+      load_map(fd, opt.map_path, info);
+    } catch (const std::exception& e) {
+      std::fprintf(stderr, "%s\n", e.what());
+      return 1;
+    }
+
+    std::atomic<uint32_t> next_req{0};
+    std::vector<ConnResult> res(conns);
+    std::vector<std::thread> th;
+    const auto t0 = clock_type::now();
+    for (uint32_t c = 0; c < conns; ++c)
+      th.emplace_back([&, c] { run_conn(opt, S, info.map_id, next_req, res[c]); });
+    for (auto& t : th) t.join();
+    const double wall_ms = std::chrono::duration<double, std::milli>(clock_type::now() - t0).count();
+
+    std::vector<double> lat;
+    uint64_t queries = 0, path_nodes = 0, errors = 0;
+    for (const auto& r : res) {
+      lat.insert(lat.end(), r.lat_us.begin(), r.lat_us.end());
+      queries += r.queries; path_nodes += r.path_nodes; errors += r.errors;
+      if (!r.error.empty()) std::fprintf(stderr, "error: %s\n", r.error.c_str());
+    }
+    std::sort(lat.begin(), lat.end());
+    const SampleStats st = summarize(lat);
+    std::printf("map %u %ux%u diag=%d engine=%s conns=%u depth=%u batch=%u path=%s\n",
+                info.map_id, info.width, info.height, (info.flags & kMapAllowDiag) ? 1 : 0,
+                engine_name(opt.engine),
+                conns, opt.depth, opt.batch, opt.want_path ? "yes" : "no");
+    std::printf("requests=%zu queries=%llu errors=%llu wall=%.3fms throughput=%.0f q/s (%.0f req/s)%s\n",
+                lat.size(), (unsigned long long)queries, (unsigned long long)errors, wall_ms,
+                (double)queries / (wall_ms / 1000.0), (double)lat.size() / (wall_ms / 1000.0),
+                opt.want_path ? (" path_nodes=" + std::to_string(path_nodes)).c_str() : "");
+    std::printf("latency us: min=%.1f p50=%.1f p90=%.1f p99=%.1f p99.9=%.1f max=%.1f mean=%.1f\n",
+                st.min, st.median, st.p90, st.p99, percentile_sorted(lat, 0.999), st.max, st.mean);
+    if (errors) rc = 1;
+
+    // --verify: 로컬에서 heap A* 로 다시 풀어 dist 비교 (대각 허용 여부는 서버 MapInfo 기준)
+    if (verify) {
+      GridMap G(opt.map_path, (info.flags & kMapAllowDiag) != 0);
+      auto pq = std::make_unique<HeapPQ>();
+      SearchWorkspace ws(G.num_nodes());
+      std::vector<Cost32> ref(S.size(), Key::INF);
+      std::vector<char> done(S.size(), 0);
+      uint64_t mismatch = 0, checked = 0;
+      for (const auto& r : res) {
+        for (const auto& [i, d] : r.dists) {
+          if (!done[i]) {
+            const auto& c = S[i];
+            const NodeId s = node_from_xy(c.sx, c.sy, G.width());
+            const NodeId g = node_from_xy(c.gx, c.gy, G.width());
+            ref[i] = run_engine(Engine::AStar, G, s, g, *pq, ws).dist(g);
+            done[i] = 1;
+          }
+          ++checked;
+          if (d != ref[i]) {
+            if (mismatch < 10)
+              std::fprintf(stderr, "MISMATCH case %u: server=%u local=%u\n", i, d, ref[i]);
+            ++mismatch;
+          }
+        }
+      }
+      std::printf("verify: %llu results, %llu mismatches\n",
+                  (unsigned long long)checked, (unsigned long long)mismatch);
+      if (mismatch) rc = 1;
+    }
+  }
+
+  if (shutdown) {
+    const int fd = unix_connect(opt.socket_path);
+    write_frame(fd, MsgType::Shutdown, 0, nullptr, 0);
+    ::close(fd);
+  }
+  return rc;
+}
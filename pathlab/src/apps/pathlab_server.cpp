@@ -0,0 +1,376 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <csignal>
+#include <stdexcept>
+#include <cerrno>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/io/scen_loader.hpp"
+#include "pathlab/queues/pq_factory.hpp"
+#include "pathlab/ll/engine.hpp"
+#include "pathlab/ll/jps.hpp"
+#include "pathlab/ll/alt.hpp"
+#include "pathlab/server/protocol.hpp"
+
+using namespace pathlab;
+
+namespace {
+
+struct ServerOptions {
+  bool        allow_diag = true;
+  std::string pq = "heap";
+  uint32_t    stoc_block = 0;   // 0 = 정렬 커널별 기본 (STOCPQ::default_block_size)
+  uint32_t    landmarks = 16;
+  LandmarkSelect select = LandmarkSelect::Farthest;
+};
+
+// 상주 맵: 한 번 올리면 서버가 끝날 때까지 유지 (id = 로드 순서)
+// JPS+/ALT 테이블은 처음 요청될 때 한 번만 로드/생성
+struct Resident {
+  std::string path;
+  GridMap G;
+  std::once_flag jt_once, lt_once;
+  JumpTable jt;
+  LandmarkTable lt;
+
+  Resident(const std::string& p, bool diag) : path(p), G(p, diag) {}
+};
+
+class MapRegistry {
+public:
+  explicit MapRegistry(const ServerOptions& opt) : opt_(opt) {}
+
+  // 같은 경로는 같은 id
+  uint32_t load(const std::string& path) {
+    std::lock_guard<std::mutex> lk(mu_);
+    for (std::size_t i = 0; i < maps_.size(); ++i)
+      if (maps_[i]->path == path) return (uint32_t)i;
+    maps_.push_back(std::make_unique<Resident>(path, opt_.allow_diag));
+    return (uint32_t)(maps_.size() - 1);
+  }
+  Resident* get(uint32_t id) {
+    std::lock_guard<std::mutex> lk(mu_);
+    return id < maps_.size() ? maps_[id].get() : nullptr;
+  }
+  const JumpTable* jump_table(Resident& m) {
+    std::call_once(m.jt_once, [&] { m.jt = JumpTable::load_or_build(m.G, m.path); });
+    return &m.jt;
+  }
+  const LandmarkTable* landmarks(Resident& m) {
+    std::call_once(m.lt_once, [&] {
+      m.lt = LandmarkTable::load_or_build(m.G, m.path, opt_.landmarks, opt_.select);
+    });
+    return &m.lt;
+  }
+
+private:
+  const ServerOptions& opt_;
+  std::mutex mu_;
+  std::vector<std::unique_ptr<Resident>> maps_;
+};
+
+// 연결 하나: 읽기는 reader 스레드 하나, 쓰기는 워커들이 wmu 로 직렬화
+struct Conn {
+  int in_fd, out_fd;
+  bool owns_fd;
+  std::mutex wmu;
+  std::atomic<bool> broken{false};
+
+  Conn(int in, int out, bool owns) : in_fd(in), out_fd(out), owns_fd(owns) {}
+  ~Conn() {
+    if (!owns_fd) return;
+    ::close(in_fd);
+    if (out_fd != in_fd) ::close(out_fd);
+  }
+  void send(MsgType t, uint32_t req_id, const std::vector<uint8_t>& buf, uint16_t flags = 0) {
+    if (broken.load(std::memory_order_relaxed)) return;
+    std::lock_guard<std::mutex> lk(wmu);
+    if (!write_frame(out_fd, t, req_id, buf.data(), buf.size(), flags))
+      broken.store(true, std::memory_order_relaxed);
+  }
+  void send_error(uint32_t req_id, const std::string& msg) {
+    send(MsgType::Error, req_id, std::vector<uint8_t>(msg.begin(), msg.end()));
+  }
+};
+
+struct Job {
+  std::shared_ptr<Conn> conn;
+  uint32_t req_id;
+  std::vector<uint8_t> payload;   // QueryHeader + QueryRec×n
+};
+
+constexpr uint32_t kResultChunk = 256;   // 결과 프레임당 최대 쿼리 수
+
+// 워커 풀: 요청(배치) 단위 FIFO, 워커마다 큐/워크스페이스 보유
+class WorkerPool {
+public:
+  WorkerPool(MapRegistry& maps, const ServerOptions& opt, unsigned n)
+      : maps_(maps), opt_(opt), served_(n) {
+    for (unsigned i = 0; i < n; ++i) th_.emplace_back([this, i] { run_(i); });
+  }
+  ~WorkerPool() { stop(); }
+
+  void submit(Job&& j) {
+    { std::lock_guard<std::mutex> lk(mu_); jobs_.push_back(std::move(j)); }
+    cv_.notify_one();
+  }
+  // 남은 요청을 모두 처리한 뒤 종료
+  void stop() {
+    { std::lock_guard<std::mutex> lk(mu_); stop_ = true; }
+    cv_.notify_all();
+    for (auto& t : th_) t.join();
+    th_.clear();
+  }
+  uint64_t queries() const {
+    uint64_t n = 0;
+    for (const auto& s : served_) n += s;
+    return n;
+  }
+  const std::vector<uint64_t>& served() const { return served_; }
+
+private:
+  struct Worker {
+    SearchWorkspace ws;
+    // (맵, 엔진) → 큐 (bucket 폭이 맵/엔진마다 다름)
+    std::map<std::pair<uint32_t, int>, std::unique_ptr<IPQ>> pqs;
+  };
+
+  void run_(unsigned id) {
+    Worker w;
+    for (;;) {
+      Job j;
+      {
+        std::unique_lock<std::mutex> lk(mu_);
+        cv_.wait(lk, [&] { return stop_ || !jobs_.empty(); });
+        if (jobs_.empty()) return;
+        j = std::move(jobs_.front());
+        jobs_.pop_front();
+      }
+      try {
+        served_[id] += handle_(w, j);
+      } catch (const std::exception& e) {
+        j.conn->send_error(j.req_id, e.what());
+      }
+    }
+  }
+
+  std::size_t handle_(Worker& w, Job& j) {
+    if (j.payload.size() < sizeof(QueryHeader)) throw std::runtime_error("short query frame");
+    QueryHeader qh;
+    std::memcpy(&qh, j.payload.data(), sizeof(qh));
+    if (j.payload.size() != sizeof(QueryHeader) + (std::size_t)qh.count * sizeof(QueryRec))
+      throw std::runtime_error("query frame size mismatch");
+    if (qh.engine > (uint8_t)Engine::ALT) throw std::runtime_error("unknown engine");
+    Resident* m = maps_.get(qh.map_id);
+    if (!m) throw std::runtime_error("unknown map id");
+
+    const GridMap& G = m->G;
+    const Engine e = (Engine)qh.engine;
+    const JumpTable* jt = (e == Engine::JPSPlus) ? maps_.jump_table(*m) : nullptr;
+    const LandmarkTable* lt = (e == Engine::ALT) ? maps_.landmarks(*m) : nullptr;
+    auto& pq = w.pqs[{qh.map_id, (int)e}];
+    if (!pq) pq = make_pq(opt_.pq, opt_.stoc_block, engine_bucket_width(e, G), m->path, engine_name(e), graph_hash(G));
+
+    const bool want_path = (qh.flags & kQueryWantPath) != 0;
+    const auto* recs = reinterpret_cast<const QueryRec*>(j.payload.data() + sizeof(QueryHeader));
+    const NodeId INVALID = SearchWorkspace::INVALID;
+    std::vector<uint8_t> out;
+    std::vector<NodeId> path;
+    uint32_t first = 0;
+    for (uint32_t i = 0; i < qh.count; ++i) {
+      if (i % kResultChunk == 0) {
+        out.clear();
+        first = i;
+        append_pod(out, ResultHeader{std::min(kResultChunk, qh.count - i), first});
+      }
+      QueryRec q;
+      std::memcpy(&q, recs + i, sizeof(q));
+      Cost32 dist = Key::INF;
+      path.clear();
+      if (G.passable(q.sx, q.sy) && G.passable(q.gx, q.gy)) {
+        const NodeId s = node_from_xy(q.sx, q.sy, G.width());
+        const NodeId g = node_from_xy(q.gx, q.gy, G.width());
+        SearchView R = run_engine(e, G, s, g, *pq, w.ws, jt, lt);
+        dist = R.dist(g);
+        // 경로: g 에서 parent 를 따라 s 까지 (JPS 계열은 jump point 경유점)
+        if (want_path && dist != Key::INF) {
+          for (NodeId v = g; v != INVALID; v = (v == s) ? INVALID : R.parent(v)) path.push_back(v);
+          if (path.back() != s) path.clear();
+          std::reverse(path.begin(), path.end());
+        }
+      }
+      append_pod(out, (uint32_t)dist);
+      append_pod(out, (uint32_t)path.size());
+      append_bytes(out, path.data(), path.size() * sizeof(NodeId));
+      const bool last = (i + 1 == qh.count);
+      if (last || (i + 1) % kResultChunk == 0)
+        j.conn->send(MsgType::Result, j.req_id, out, last ? 0 : kFrameMore);
+    }
+    if (qh.count == 0) {
+      append_pod(out, ResultHeader{0, 0});
+      j.conn->send(MsgType::Result, j.req_id, out);
+    }
+    return qh.count;
+  }
+
+  MapRegistry& maps_;
+  const ServerOptions& opt_;
+  std::vector<std::thread> th_;
+  std::mutex mu_;
+  std::condition_variable cv_;
+  std::deque<Job> jobs_;
+  bool stop_ = false;
+  std::vector<uint64_t> served_;   // 워커별 처리 쿼리 수 (워커 자신만 씀)
+};
+
+std::atomic<bool> g_stop{false};
+int g_listen_fd = -1;
+
+// 살아 있는 소켓 연결: 종료 시 읽기를 끊어 reader 스레드를 깨움
+std::mutex g_conn_mu;
+std::condition_variable g_conn_cv;
+std::vector<std::weak_ptr<Conn>> g_conns;
+std::size_t g_readers = 0;
+
+void request_stop() {
+  if (g_stop.exchange(true)) return;
+  if (g_listen_fd >= 0) ::shutdown(g_listen_fd, SHUT_RDWR);   // accept() 깨우기
+  std::lock_guard<std::mutex> lk(g_conn_mu);
+  for (auto& w : g_conns)
+    if (auto c = w.lock()) ::shutdown(c->in_fd, SHUT_RD);
+}
+
+// 연결 하나의 요청 읽기 루프: LoadMap 은 바로 처리, Query 는 워커 풀로
+void serve_conn(std::shared_ptr<Conn> c, MapRegistry& maps, WorkerPool& pool) {
+  FrameHeader h;
+  std::vector<uint8_t> payload;
+  while (!g_stop.load() && read_frame(c->in_fd, h, payload)) {
+    switch ((MsgType)h.type) {
+      case MsgType::Query:
+        pool.submit(Job{c, h.req_id, std::move(payload)});
+        payload = {};
+        break;
+      case MsgType::LoadMap: {
+        try {
+          const std::string path(payload.begin(), payload.end());
+          const uint32_t id = maps.load(path);
+          const GridMap& G = maps.get(id)->G;
+          std::vector<uint8_t> out;
+          append_pod(out, MapInfoMsg{id, (uint32_t)G.width(), (uint32_t)G.height(),
+                                     G.allow_diag() ? kMapAllowDiag : 0u});
+          c->send(MsgType::MapInfo, h.req_id, out);
+        } catch (const std::exception& e) {
+          c->send_error(h.req_id, e.what());
+        }
+        break;
+      }
+      case MsgType::Shutdown:
+        request_stop();
+        return;
+      default:
+        c->send_error(h.req_id, "unknown message type");
+        break;
+    }
+  }
+}
+
+} // namespace
+
+// 상주 경로 탐색 서버: 맵을 메모리에 두고 Unix 소켓/stdin 으로 배치 쿼리를 받음
+int main(int argc, char** argv) {
+  std::vector<std::string> pos;
+  std::string socket_path;
+  bool stdio = false;
+  unsigned threads = std::thread::hardware_concurrency();
+  std::string select_str = "farthest";
+  ServerOptions opt;
+  for (int i = 1; i < argc; ++i) {
+    std::string a = argv[i];
+    if      (a.rfind("--socket=", 0) == 0)    socket_path = a.substr(9);
+    else if (a == "--stdio")                  stdio = true;
+    else if (a.rfind("--threads=", 0) == 0)   threads = (unsigned)std::strtoul(a.c_str() + 10, nullptr, 10);
+    else if (a.rfind("--pq=", 0) == 0)        opt.pq = a.substr(5);
+    else if (a.rfind("--block=", 0) == 0)     opt.stoc_block = (uint32_t)std::strtoul(a.c_str() + 8, nullptr, 10);
+    else if (a.rfind("--landmarks=", 0) == 0) opt.landmarks = (uint32_t)std::strtoul(a.c_str() + 12, nullptr, 10);
+    else if (a.rfind("--select=", 0) == 0)    select_str = a.substr(9);
+    else if (a == "--no-diag")                opt.allow_diag = false;
+    else pos.push_back(a);
+  }
+  if (stdio == !socket_path.empty() || !parse_landmark_select(select_str, opt.select)) {
+    std::fprintf(stderr,
+      "usage: pathlab_server (--socket=<path> | --stdio) [map...] [--threads=nproc]\n"
+      "       [--pq=heap|...|auto] [--block=0 (kernel default)] [--landmarks=16] [--select=farthest|avoid] [--no-diag]\n");
+    return 1;
+  }
+  if (threads == 0) threads = 1;
+  std::signal(SIGPIPE, SIG_IGN);         // 끊긴 연결에 쓰기 → write 실패로 처리
+
+  MapRegistry maps(opt);
+  for (const auto& p : pos) {
+    const uint32_t id = maps.load(p);
+    const GridMap& G = maps.get(id)->G;
+    std::fprintf(stderr, "map %u: %s (%dx%d)\n", id, p.c_str(), G.width(), G.height());
+  }
+
+  WorkerPool pool(maps, opt, threads);
+  if (stdio) {
+    // 요청은 stdin, 응답은 stdout (EOF 또는 Shutdown 이면 남은 요청 처리 후 종료)
+    serve_conn(std::make_shared<Conn>(0, 1, false), maps, pool);
+  } else {
+    try {
+      g_listen_fd = unix_listen(socket_path);
+    } catch (const std::exception& e) {
+      std::fprintf(stderr, "%s\n", e.what());
+      return 1;
+    }
+    std::fprintf(stderr, "listening on %s (threads=%u pq=%s)\n",
+                 socket_path.c_str(), threads, opt.pq.c_str());
+    while (!g_stop.load()) {
+      const int fd = ::accept4(g_listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+      if (fd < 0) {
+        if (errno == EINTR) continue;
+        break;
+      }
+      auto c = std::make_shared<Conn>(fd, fd, true);
+      {
+        std::lock_guard<std::mutex> lk(g_conn_mu);
+        g_conns.erase(std::remove_if(g_conns.begin(), g_conns.end(),
+                                     [](const std::weak_ptr<Conn>& w) { return w.expired(); }),
+                      g_conns.end());
+        g_conns.push_back(c);
+        ++g_readers;
+      }
+      std::thread([c, &maps, &pool] {
+        serve_conn(c, maps, pool);
+        std::lock_guard<std::mutex> lk(g_conn_mu);
+        if (--g_readers == 0) g_conn_cv.notify_all();
+      }).detach();
+    }
+    request_stop();
+    {
+      std::unique_lock<std::mutex> lk(g_conn_mu);
+      g_conn_cv.wait(lk, [] { return g_readers == 0; });
+    }
+    ::close(g_listen_fd);
+    ::unlink(socket_path.c_str());
+  }
+  pool.stop();
+
+  std::fprintf(stderr, "served %llu queries, per worker:", (unsigned long long)pool.queries());
+  for (uint64_t n : pool.served()) std::fprintf(stderr, " %llu", (unsigned long long)n);
+  std::fprintf(stderr, "\n");
+  return 0;
+}
@@ -0,0 +1,72 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "pathlab/queues/pq_factory.hpp"
+#include "pathlab/queues/pq_trace.hpp"
+
+using namespace pathlab;
+
+// bench_single --trace 로 기록한 큐 연산을 큐마다 재생해 ns/op 비교
+int main(int argc, char** argv) {
+  std::vector<std::string> pos;
+  uint32_t stoc_block = 0;   // 0 = 정렬 커널별 기본 (STOCPQ::default_block_size)
+  uint32_t bucket_w = 0;   // 0 = 트레이스에서 계산
+  int reps = 3;
+  for (int i = 1; i < argc; ++i) {
+    std::string a = argv[i];
+    if      (a.rfind("--block=", 0) == 0)    stoc_block = (uint32_t)std::strtoul(a.c_str() + 8, nullptr, 10);
+    else if (a.rfind("--bucket_w=", 0) == 0) bucket_w = (uint32_t)std::strtoul(a.c_str() + 11, nullptr, 10);
+    else if (a.rfind("--reps=", 0) == 0)     reps = std::atoi(a.c_str() + 7);
+    else pos.push_back(a);
+  }
+  if (pos.size() < 2) {
+    std::fprintf(stderr,
+      "usage: pq_replay <trace> <pq> [pq...] [--block=0 (kernel default)] [--bucket_w=auto] [--reps=3]\n"
+      "       pq: heap|stoc[_radix|_net]|bucket|radix|dary{2,4,8}|lazy{2,4,8}\n");
+    return 1;
+  }
+  if (reps < 1) reps = 1;
+
+  PQTrace T = PQTrace::load(pos[0]);
+  if (bucket_w == 0) bucket_w = T.max_key_span();
+  const bool monotone = T.monotone();
+  std::printf("trace %s: %zu ops (%.1f MB)%s%s bucket_w=%u\n",
+              pos[0].c_str(), T.recs.size(),
+              (double)(T.recs.size() * sizeof(PQTraceRec)) / (1024.0 * 1024.0),
+              T.unordered ? " recorded-unordered" : "",
+              monotone ? "" : " non-monotone", bucket_w);
+
+  bool first = true;
+  for (std::size_t qi = 1; qi < pos.size(); ++qi) {
+    auto Q = make_pq(pos[qi], stoc_block, bucket_w);
+    // 단조 키 전제 큐는 비단조 트레이스(비정렬 큐로 기록) 재생 불가 (bucket@counters 등 포함)
+    if (!monotone && Q->requires_monotone()) {
+      std::printf("pq=%s skipped: trace keys are not monotone\n", pos[qi].c_str());
+      continue;
+    }
+    PQReplayStats best;
+    for (int r = 0; r < reps; ++r) {   // 최솟값 사용 (첫 회는 페이지 폴트/할당 포함)
+      PQReplayStats st = replay_trace(T, *Q);
+      if (r == 0 || st.ns < best.ns) best = st;
+    }
+    if (first) {
+      std::printf("ops:");
+      for (int i = 0; i < kNumPQOps; ++i)
+        std::printf(" %s=%llu", pq_op_name((PQOp)i), (unsigned long long)best.ops[i]);
+      std::printf("\n");
+      first = false;
+    }
+    const uint64_t n = best.total_ops();
+    std::printf("pq=%s time=%.3fms ns/op=%.2f Mops/s=%.2f | pop_diff=%llu diverged=%llu skipped=%llu\n",
+                pos[qi].c_str(), best.ns / 1e6,
+                n ? best.ns / (double)n : 0.0,
+                best.ns > 0.0 ? (double)n * 1e3 / best.ns : 0.0,
+                (unsigned long long)best.pop_diff,
+                (unsigned long long)best.diverged,
+                (unsigned long long)best.skipped);
+  }
+  return 0;
+}
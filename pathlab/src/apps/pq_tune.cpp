@@ -0,0 +1,138 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <sstream>
+
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/io/scen_loader.hpp"
+#include "pathlab/ll/engine.hpp"
+#include "pathlab/ll/jps.hpp"
+#include "pathlab/ll/alt.hpp"
+#include "pathlab/queues/pq_profile.hpp"
+#include "pathlab/batch/pq_tuner.hpp"
+
+using namespace pathlab;
+
+static std::vector<std::string> split_list(const std::string& s) {
+  std::vector<std::string> out;
+  std::stringstream ss(s);
+  std::string item;
+  while (std::getline(ss, item, ',')) if (!item.empty()) out.push_back(item);
+  return out;
+}
+
+// 맵의 scen 표본으로 큐/블록 크기를 엔진마다 측정해 <map>.pqprof 에 기록
+// (이후 bench_single/bench_batch/pathlab_server 에서 pq=auto 로 사용)
+int main(int argc, char** argv) {
+  std::vector<std::string> pos;
+  std::string engines_str = "astar";
+  std::string pq_list;       // name[:block],... (비면 기본 후보)
+  std::string blocks_str = "64,128,256,512,1024";
+  uint32_t samples = 200;
+  uint32_t landmarks = 16;
+  std::string select_str = "farthest";
+  bool save = true;
+  TuneOptions topt;
+  for (int i = 1; i < argc; ++i) {
+    std::string a = argv[i];
+    if      (a.rfind("--engine=", 0) == 0)    engines_str = a.substr(9);
+    else if (a.rfind("--pq=", 0) == 0)        pq_list = a.substr(5);
+    else if (a.rfind("--blocks=", 0) == 0)    blocks_str = a.substr(9);
+    else if (a.rfind("--samples=", 0) == 0)   samples = (uint32_t)std::strtoul(a.c_str() + 10, nullptr, 10);
+    else if (a.rfind("--reps=", 0) == 0)      topt.reps = (uint32_t)std::strtoul(a.c_str() + 7, nullptr, 10);
+    else if (a.rfind("--warmup=", 0) == 0)    topt.warmup = (uint32_t)std::strtoul(a.c_str() + 9, nullptr, 10);
+    else if (a.rfind("--prune=", 0) == 0)     topt.prune = std::strtod(a.c_str() + 8, nullptr);
+    else if (a.rfind("--landmarks=", 0) == 0) landmarks = (uint32_t)std::strtoul(a.c_str() + 12, nullptr, 10);
+    else if (a.rfind("--select=", 0) == 0)    select_str = a.substr(9);
+    else if (a == "--no-save")                save = false;
+    else pos.push_back(a);
+  }
+  std::vector<Engine> engines;
+  bool ok = pos.size() >= 2;
+  for (const auto& name : split_list(engines_str)) {
+    Engine e;
+    if (!parse_engine(name, e)) { ok = false; break; }
+    engines.push_back(e);
+  }
+  LandmarkSelect select = LandmarkSelect::Farthest;
+  if (!ok || engines.empty() || !parse_landmark_select(select_str, select)) {
+    std::fprintf(stderr,
+      "usage: pq_tune <map> <scen> [allow_diag=1] [--engine=astar[,jps,...]] [--samples=200]\n"
+      "       [--reps=5] [--warmup=1] [--prune=4, 0=off] [--blocks=64,128,256,512,1024] [--pq=heap,stoc:512,...]\n"
+      "       [--landmarks=16] [--select=farthest|avoid] [--no-save]\n");
+    return 1;
+  }
+  const std::string map_path = pos[0];
+  const int allow_diag = (pos.size() > 2) ? std::atoi(pos[2].c_str()) : 1;
+
+  if (!pq_list.empty()) {
+    for (const auto& item : split_list(pq_list)) {
+      const auto colon = item.find(':');
+      TuneCandidate c;
+      c.pq = item.substr(0, colon);
+      c.stoc_block = (colon == std::string::npos) ? 0u
+                   : (uint32_t)std::strtoul(item.c_str() + colon + 1, nullptr, 10);
+      topt.candidates.push_back(c);
+    }
+  } else {
+    std::vector<uint32_t> blocks;
+    for (const auto& b : split_list(blocks_str)) blocks.push_back((uint32_t)std::strtoul(b.c_str(), nullptr, 10));
+    topt.candidates = default_tune_candidates(blocks);
+  }
+
+  GridMap G(map_path, allow_diag != 0);
+  const auto S = load_scen(pos[1]);
+  const std::vector<BatchQuery> Q = sample_queries(G, S, samples);
+  std::printf("map %s (%dx%d) samples=%zu reps=%u candidates=%zu\n",
+              map_path.c_str(), G.width(), G.height(), Q.size(), topt.reps, topt.candidates.size());
+
+  const std::string prof_path = PQProfile::cache_path(map_path);
+  PQProfile P;
+  P.load(prof_path);   // 다른 엔진/그래프 항목은 유지
+  const uint64_t ghash = graph_hash(G);
+
+  JumpTable jt;
+  LandmarkTable lt;
+  for (Engine e : engines) {
+    if (e == Engine::JPSPlus && jt.empty()) jt = JumpTable::load_or_build(G, map_path);
+    if (e == Engine::ALT && lt.empty()) lt = LandmarkTable::load_or_build(G, map_path, landmarks, select);
+    topt.engine = e;
+    topt.jt = &jt;
+    topt.lt = &lt;
+    const std::vector<TuneResult> R = tune_pq(G, Q, topt);
+
+    std::printf("engine=%s\n", engine_name(e));
+    for (const auto& r : R) {
+      char name[64];
+      if (r.c.pq.rfind("stoc", 0) == 0) std::snprintf(name, sizeof(name), "%s:%u", r.c.pq.c_str(), r.c.stoc_block);
+      else                              std::snprintf(name, sizeof(name), "%s", r.c.pq.c_str());
+      std::printf("  %-16s median=%.3fms min=%.3fms %.0f ns/query x%.2f%s%s\n",
+                  name, r.median_ns / 1e6, r.min_ns / 1e6, r.ns_per_query,
+                  R[0].median_ns > 0.0 ? r.median_ns / R[0].median_ns : 0.0,
+                  r.dist_ok ? "" : " DIST_MISMATCH", r.pruned && r.dist_ok ? " (pruned)" : "");
+    }
+    if (R.empty() || !R[0].dist_ok) {
+      std::fprintf(stderr, "no valid candidate for engine=%s\n", engine_name(e));
+      return 1;
+    }
+    PQProfileEntry best;
+    best.engine = engine_name(e);
+    best.graph_hash = ghash;
+    best.pq = R[0].c.pq;
+    best.stoc_block = R[0].c.stoc_block;
+    best.ns_per_query = R[0].ns_per_query;
+    best.samples = (uint32_t)Q.size();
+    P.set(best);
+    std::printf("  best: %s block=%u\n", best.pq.c_str(), best.stoc_block);
+  }
+
+  if (save) {
+    if (!P.save(prof_path)) {
+      std::fprintf(stderr, "cannot write %s\n", prof_path.c_str());
+      return 1;
+    }
+    std::printf("profile written: %s\n", prof_path.c_str());
+  }
+  return 0;
+}
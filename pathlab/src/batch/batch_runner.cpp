@@ -0,0 +1,201 @@
+#include "pathlab/batch/batch_runner.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "pathlab/queues/pq_factory.hpp"
+#include "pathlab/io/scen_loader.hpp"
+
+namespace pathlab {
+
+namespace {
+
+struct Chunk { uint32_t begin, end; };
+
+// 워커별 작업 deque: 주인은 앞에서, 도둑은 뒤에서 꺼냄
+struct WorkQueue {
+  std::mutex mu;
+  std::deque<Chunk> q;
+
+  bool pop_front(Chunk& out) {
+    std::lock_guard<std::mutex> lk(mu);
+    if (q.empty()) return false;
+    out = q.front(); q.pop_front();
+    return true;
+  }
+  // 뒤쪽 절반(최소 1개)을 떼어 냄
+  std::size_t steal_half(std::deque<Chunk>& out) {
+    std::lock_guard<std::mutex> lk(mu);
+    const std::size_t n = (q.size() + 1) / 2;
+    for (std::size_t i = 0; i < n; ++i) { out.push_front(q.back()); q.pop_back(); }
+    return n;
+  }
+  void push_all(std::deque<Chunk>& in) {
+    std::lock_guard<std::mutex> lk(mu);
+    for (auto& c : in) q.push_back(c);
+    in.clear();
+  }
+};
+
+} // namespace
+
+BatchReport run_batch(const GridMap& G, const std::vector<BatchQuery>& queries,
+                      const BatchOptions& opt) {
+  using clock = std::chrono::steady_clock;
+  const unsigned T = opt.threads ? opt.threads : 1u;
+  const uint32_t chunk = opt.chunk ? opt.chunk : 1u;
+  const uint32_t nq = (uint32_t)queries.size();
+
+  BatchReport R;
+  R.dist.assign(nq, Key::INF);
+  R.threads.assign(T, {});
+
+  // 연속 구간을 라운드로빈으로 분배 (인접 쿼리는 비슷한 비용인 경우가 많음)
+  std::vector<WorkQueue> wq(T);
+  uint32_t k = 0;
+  for (uint32_t b = 0; b < nq; b += chunk, ++k)
+    wq[k % T].q.push_back({b, std::min(nq, b + chunk)});
+
+  const uint32_t bucket_w = engine_bucket_width(opt.engine, G);
+
+  auto worker = [&](unsigned tid) {
+    auto Q = make_pq(opt.pq, opt.stoc_block, bucket_w);
+    SearchWorkspace ws(G.num_nodes());
+    BatchThreadStats& st = R.threads[tid];
+    std::deque<Chunk> loot;
+
+    while (true) {
+      Chunk c;
+      if (!wq[tid].pop_front(c)) {
+        // 훔치기: 다른 워커를 한 바퀴 돌며 뒤쪽 절반을 가져옴
+        bool got = false;
+        for (unsigned i = 1; i < T && !got; ++i) {
+          const unsigned victim = (tid + i) % T;
+          if (wq[victim].steal_half(loot)) {
+            st.steals += loot.size();
+            wq[tid].push_all(loot);
+            got = true;
+          }
+        }
+        if (!got) break;   // 모두 비었음 (작업은 새로 생기지 않음)
+        continue;
+      }
+
+      const auto t0 = clock::now();
+      for (uint32_t i = c.begin; i < c.end; ++i) {
+        const BatchQuery& q = queries[i];
+        SearchView V = run_engine(opt.engine, G, q.s, q.g, *Q, ws, opt.jt, opt.lt);
+        R.dist[i] = V.dist(q.g);
+        st.algo += V.algo;
+        st.pq += V.pq;
+        st.queries++;
+      }
+      st.busy_ms += std::chrono::duration<double, std::milli>(clock::now() - t0).count();
+    }
+  };
+
+  const auto t0 = clock::now();
+  std::vector<std::thread> pool;
+  pool.reserve(T - 1);
+  for (unsigned t = 1; t < T; ++t) pool.emplace_back(worker, t);
+  worker(0);
+  for (auto& th : pool) th.join();
+  R.wall_ms = std::chrono::duration<double, std::milli>(clock::now() - t0).count();
+  R.qps = (R.wall_ms > 0.0) ? (double)nq * 1000.0 / R.wall_ms : 0.0;
+  return R;
+}
+
+BatchReport run_batch_stream(const GridMap& G, ScenReader& reader,
+                             const BatchOptions& opt, std::size_t batch) {
+  using clock = std::chrono::steady_clock;
+  const unsigned T = opt.threads ? opt.threads : 1u;
+  const uint32_t chunk = opt.chunk ? opt.chunk : 1u;
+  if (batch == 0) batch = 1;
+
+  // 파싱된 배치 하나 (워커는 [begin,end) 구간 단위로 가져감)
+  struct Batch {
+    std::vector<BatchQuery> q;
+    std::vector<Cost32> dist;
+  };
+  struct Item { Batch* b; uint32_t begin, end; };
+
+  std::vector<std::unique_ptr<Batch>> batches;   // 생산자만 추가, 순서 = 파일 순서
+  std::deque<Item> pending;
+  std::mutex mu;
+  std::condition_variable cv;
+  bool done = false;
+
+  BatchReport R;
+  R.threads.assign(T, {});
+  const uint32_t bucket_w = engine_bucket_width(opt.engine, G);
+
+  auto worker = [&](unsigned tid) {
+    auto Q = make_pq(opt.pq, opt.stoc_block, bucket_w);
+    SearchWorkspace ws(G.num_nodes());
+    BatchThreadStats& st = R.threads[tid];
+    for (;;) {
+      Item it;
+      {
+        std::unique_lock<std::mutex> lk(mu);
+        cv.wait(lk, [&] { return done || !pending.empty(); });
+        if (pending.empty()) return;   // done && 비었음
+        it = pending.front();
+        pending.pop_front();
+      }
+      const auto t0 = clock::now();
+      for (uint32_t i = it.begin; i < it.end; ++i) {
+        const BatchQuery& q = it.b->q[i];
+        SearchView V = run_engine(opt.engine, G, q.s, q.g, *Q, ws, opt.jt, opt.lt);
+        it.b->dist[i] = V.dist(q.g);
+        st.algo += V.algo;
+        st.pq += V.pq;
+        st.queries++;
+      }
+      st.busy_ms += std::chrono::duration<double, std::milli>(clock::now() - t0).count();
+    }
+  };
+
+  const auto t0 = clock::now();
+  std::vector<std::thread> pool;
+  pool.reserve(T);
+  for (unsigned t = 0; t < T; ++t) pool.emplace_back(worker, t);
+
+  // 생산자: 파싱한 배치를 바로 chunk 로 쪼개 큐에 넣음
+  std::vector<ScenRecord> recs;
+  recs.reserve(batch);
+  std::size_t total = 0;
+  while (reader.next(recs, batch)) {
+    auto b = std::make_unique<Batch>();
+    b->q.resize(recs.size());
+    b->dist.assign(recs.size(), Key::INF);
+    for (std::size_t i = 0; i < recs.size(); ++i) {
+      b->q[i].s = node_from_xy(recs[i].sx, recs[i].sy, G.width());
+      b->q[i].g = node_from_xy(recs[i].gx, recs[i].gy, G.width());
+    }
+    const uint32_t n = (uint32_t)recs.size();
+    {
+      std::lock_guard<std::mutex> lk(mu);
+      for (uint32_t s = 0; s < n; s += chunk) pending.push_back({b.get(), s, std::min(n, s + chunk)});
+    }
+    cv.notify_all();
+    batches.push_back(std::move(b));
+    total += n;
+  }
+  {
+    std::lock_guard<std::mutex> lk(mu);
+    done = true;
+  }
+  cv.notify_all();
+  for (auto& th : pool) th.join();
+
+  R.dist.reserve(total);
+  for (const auto& b : batches) R.dist.insert(R.dist.end(), b->dist.begin(), b->dist.end());
+  R.wall_ms = std::chrono::duration<double, std::milli>(clock::now() - t0).count();
+  R.qps = (R.wall_ms > 0.0) ? (double)total * 1000.0 / R.wall_ms : 0.0;
+  return R;
+}
+
+} // namespace pathlab
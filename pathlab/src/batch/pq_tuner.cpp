@@ -0,0 +1,111 @@
+#include "pathlab/batch/pq_tuner.hpp"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include "pathlab/queues/pq_factory.hpp"
+#include "pathlab/queues/heap_pq.hpp"
+#include "pathlab/util/stats.hpp"
+
+namespace pathlab {
+
+std::vector<TuneCandidate> default_tune_candidates(const std::vector<uint32_t>& blocks) {
+  std::vector<TuneCandidate> out = {
+    {"heap"}, {"dary2"}, {"dary4"}, {"dary8"}, {"lazy2"}, {"lazy4"}, {"lazy8"},
+    {"radix"}, {"bucket"},
+  };
+  for (uint32_t b : blocks) out.push_back({"stoc", b});
+  out.push_back({"stoc_radix", 0});
+  out.push_back({"stoc_net", 0});
+  return out;
+}
+
+std::vector<BatchQuery> sample_queries(const GridMap& G, const std::vector<ScenCase>& S,
+                                       uint32_t n) {
+  std::vector<BatchQuery> Q;
+  if (S.empty() || n == 0) return Q;
+  if (n > S.size()) n = (uint32_t)S.size();
+  Q.reserve(n);
+  for (uint32_t i = 0; i < n; ++i) {
+    const ScenCase& c = S[(std::size_t)i * S.size() / n];
+    Q.push_back({node_from_xy(c.sx, c.sy, G.width()), node_from_xy(c.gx, c.gy, G.width())});
+  }
+  return Q;
+}
+
+std::vector<TuneResult> tune_pq(const GridMap& G, const std::vector<BatchQuery>& Q,
+                                const TuneOptions& opt) {
+  using clock = std::chrono::steady_clock;
+  const std::vector<TuneCandidate> C =
+      opt.candidates.empty() ? default_tune_candidates() : opt.candidates;
+  const uint32_t bw = engine_bucket_width(opt.engine, G);
+  SearchWorkspace ws(G.num_nodes());
+
+  // 기준 dist: heap
+  std::vector<Cost32> ref(Q.size());
+  {
+    HeapPQ H;
+    for (std::size_t i = 0; i < Q.size(); ++i)
+      ref[i] = run_engine(opt.engine, G, Q[i].s, Q[i].g, H, ws, opt.jt, opt.lt).dist(Q[i].g);
+  }
+
+  std::vector<std::unique_ptr<IPQ>> pqs;
+  for (const auto& c : C) pqs.push_back(make_pq(c.pq, c.stoc_block, bw));
+
+  std::vector<TuneResult> R(C.size());
+  std::vector<std::vector<double>> samples(C.size());
+  for (std::size_t k = 0; k < C.size(); ++k) R[k].c = C[k];
+
+  // limit_ns > 0: 넘으면 중단하고 전체 시간으로 외삽 (pruned 후보 판정용)
+  auto pass = [&](std::size_t k, bool check, double limit_ns) {
+    IPQ& pq = *pqs[k];
+    const auto t0 = clock::now();
+    for (std::size_t i = 0; i < Q.size(); ++i) {
+      const SearchView V = run_engine(opt.engine, G, Q[i].s, Q[i].g, pq, ws, opt.jt, opt.lt);
+      if (check && V.dist(Q[i].g) != ref[i]) R[k].dist_ok = false;
+      if (limit_ns > 0.0) {
+        const double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - t0).count();
+        if (ns > limit_ns && i + 1 < Q.size()) {
+          R[k].pruned = true;
+          return ns * (double)Q.size() / (double)(i + 1);
+        }
+      }
+    }
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - t0).count();
+  };
+
+  // 첫 회(dist 검사 겸)로 가망 없는 후보를 거른 뒤 나머지만 warmup + reps 회
+  // (이미 지금까지의 최고보다 prune 배 넘게 걸린 후보는 첫 회도 중간에 끊음)
+  std::vector<double> first(C.size());
+  double best = 0.0;
+  for (std::size_t k = 0; k < C.size(); ++k) {
+    first[k] = pass(k, true, (opt.prune > 0.0 && best > 0.0) ? opt.prune * best : 0.0);
+    if (R[k].dist_ok && !R[k].pruned && (best == 0.0 || first[k] < best)) best = first[k];
+  }
+  for (std::size_t k = 0; k < C.size(); ++k)
+    R[k].pruned = R[k].pruned || !R[k].dist_ok || (opt.prune > 0.0 && first[k] > opt.prune * best);
+
+  const uint32_t reps = std::max(1u, opt.reps);
+  const uint32_t warmup = opt.warmup > 0 ? opt.warmup - 1 : 0;   // 첫 회가 warmup 1 회 몫
+  for (uint32_t r = 0; r < warmup + reps; ++r) {
+    for (std::size_t k = 0; k < C.size(); ++k) {
+      if (R[k].pruned) continue;
+      const double ns = pass(k, false, 0.0);
+      if (r >= warmup) samples[k].push_back(ns);
+    }
+  }
+
+  for (std::size_t k = 0; k < C.size(); ++k) {
+    if (samples[k].empty()) samples[k].push_back(first[k]);
+    const SampleStats st = summarize(samples[k]);
+    R[k].median_ns = st.median;
+    R[k].min_ns = st.min;
+    R[k].ns_per_query = Q.empty() ? 0.0 : st.median / (double)Q.size();
+  }
+  std::stable_sort(R.begin(), R.end(), [](const TuneResult& a, const TuneResult& b) {
+    if (a.dist_ok != b.dist_ok) return a.dist_ok;
+    return a.median_ns < b.median_ns;
+  });
+  return R;
+}
+
+} // namespace pathlab
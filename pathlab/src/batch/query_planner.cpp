@@ -0,0 +1,100 @@
+#include "pathlab/batch/query_planner.hpp"
+#include <algorithm>
+#include <numeric>
+#include "pathlab/queues/pq_factory.hpp"
+
+namespace pathlab {
+
+QueryPlanner::QueryPlanner(const IGraph& G, const PlannerOptions& opt)
+    : G_(G), opt_(opt), ws_(G.num_nodes()) {
+  const uint32_t bw = opt.bucket_w ? opt.bucket_w : G.max_edge_cost();
+  Q_ = make_pq(opt.pq, opt.stoc_block, bw);
+}
+
+QueryPlanner::Tree* QueryPlanner::lookup_(NodeId s) {
+  auto it = index_.find(s);
+  if (it == index_.end()) return nullptr;
+  lru_.splice(lru_.begin(), lru_, it->second);
+  return &lru_.front();
+}
+
+void QueryPlanner::store_(NodeId s, Cost32 radius) {
+  if (opt_.cache_trees == 0) return;
+  const std::size_t N = G_.num_nodes();
+  auto it = index_.find(s);
+  if (it != index_.end()) {
+    lru_.splice(lru_.begin(), lru_, it->second);
+  } else if (lru_.size() >= opt_.cache_trees) {
+    // 가장 오래된 트리 버퍼를 재사용
+    index_.erase(lru_.back().s);
+    lru_.splice(lru_.begin(), lru_, std::prev(lru_.end()));
+    index_[s] = lru_.begin();
+  } else {
+    lru_.emplace_front();
+    index_[s] = lru_.begin();
+  }
+  Tree& t = lru_.front();
+  t.s = s;
+  t.radius = radius;
+  t.dist.resize(N);
+  for (std::size_t v = 0; v < N; ++v) t.dist[v] = ws_.dist((NodeId)v);
+}
+
+void QueryPlanner::one_to_many(NodeId s, const NodeId* goals, std::size_t n, Cost32* out) {
+  st_.queries += n;
+  st_.sources++;
+
+  const NodeId* want = goals;
+  std::size_t nwant = n;
+  if (const Tree* t = lookup_(s)) {
+    miss_.clear();
+    for (std::size_t i = 0; i < n; ++i) {
+      const Cost32 d = t->dist[goals[i]];
+      if (d <= t->radius) out[i] = d;
+      else                miss_.push_back(goals[i]);
+    }
+    if (miss_.empty()) { st_.cache_hits++; return; }
+    want = miss_.data();
+    nwant = miss_.size();
+  }
+
+  Cost32 radius = Key::INF;
+  SearchView V = dijkstra_multi(G_, s, want, nwant, *Q_, ws_, &radius);
+  st_.searches++;
+  st_.algo += V.algo;
+  st_.pq += V.pq;
+  for (std::size_t i = 0; i < n; ++i) {
+    const Cost32 d = V.dist(goals[i]);
+    // 캐시로 이미 답한 goal 은 새 트리에서 미확정일 수 있으므로 그대로 둠
+    if (want == goals || d <= radius) out[i] = d;
+  }
+  store_(s, radius);
+}
+
+std::vector<Cost32> QueryPlanner::solve(const std::vector<BatchQuery>& queries) {
+  const std::size_t nq = queries.size();
+  std::vector<Cost32> out(nq, Key::INF);
+
+  // 출발점으로 안정 정렬 → 같은 출발점 쿼리가 연속
+  std::vector<uint32_t> order(nq);
+  std::iota(order.begin(), order.end(), 0u);
+  std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+    return queries[a].s < queries[b].s;
+  });
+
+  std::vector<NodeId> goals;
+  std::vector<Cost32> dist;
+  for (std::size_t i = 0; i < nq;) {
+    const NodeId s = queries[order[i]].s;
+    std::size_t j = i;
+    goals.clear();
+    while (j < nq && queries[order[j]].s == s) goals.push_back(queries[order[j++]].g);
+    dist.assign(goals.size(), Key::INF);
+    one_to_many(s, goals.data(), goals.size(), dist.data());
+    for (std::size_t k = 0; k < goals.size(); ++k) out[order[i + k]] = dist[k];
+    i = j;
+  }
+  return out;
+}
+
+} // namespace pathlab
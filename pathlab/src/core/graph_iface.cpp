@@ -0,0 +1,36 @@
+#include "pathlab/core/graph_iface.hpp"
+
+namespace pathlab {
+
+namespace {
+
+void fnv_mix(uint64_t& h, uint32_t v) {
+  for (int i = 0; i < 4; ++i) { h ^= (v >> (i*8)) & 0xff; h *= 1099511628211ull; }
+}
+
+} // namespace
+
+Cost32 IGraph::max_edge_cost() const {
+  Cost32 w = 1;
+  for (NodeId u = 0; u < (NodeId)num_nodes(); ++u)
+    for_each_edge(u, [](NodeId, Cost32 c, void* p) {
+      auto& m = *static_cast<Cost32*>(p);
+      if (c > m) m = c;
+    }, &w);
+  return w;
+}
+
+uint64_t graph_hash(const IGraph& G) {
+  uint64_t h = 1469598103934665603ull;
+  const std::size_t N = G.num_nodes();
+  fnv_mix(h, (uint32_t)N);
+  for (NodeId u = 0; u < (NodeId)N; ++u) {
+    G.for_each_edge(u, [](NodeId v, Cost32 w, void* p) {
+      auto& hh = *static_cast<uint64_t*>(p);
+      fnv_mix(hh, v); fnv_mix(hh, w);
+    }, &h);
+  }
+  return h;
+}
+
+} // namespace pathlab
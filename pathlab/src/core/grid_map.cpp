@@ -1,14 +1,70 @@
 #include "pathlab/core/grid_map.hpp"
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace pathlab {
 
-static bool is_free_char(char c) {
+namespace {
+
+constexpr char kGmapMagic[8] = {'P','L','G','M','A','P','1','\0'};
+
+// .gmap 헤더 (64B). 섹션은 64B 정렬
+//   [header][bits: (N+63)/64 × u64][nbr: N × u8 (선택)]
+struct GmapHeader {
+  char     magic[8];
+  uint32_t width;
+  uint32_t height;
+  uint64_t bits_off;
+  uint64_t nbr_off;     // 0 이면 마스크 없음 (로드 시 계산)
+  uint64_t file_len;
+  uint64_t reserved[3];
+};
+static_assert(sizeof(GmapHeader) == 64, "gmap header must stay 64 bytes");
+
+inline std::size_t align64(std::size_t x) { return (x + 63) & ~(std::size_t)63; }
+
+bool is_free_char(char c) {
   return (c == '.' || c == 'G' || c == 'S');
 }
 
-GridMap::GridMap(const std::string& map_path, bool allow_diag) : diag_(allow_diag) {
+} // namespace
+
+GridMap::GridMap(const std::string& map_path, bool allow_diag)
+    : diag_(allow_diag), dir_mask_(allow_diag ? 0xffu : 0x0fu) {
+  if (!load_binary_(map_path)) load_text_(map_path);
+  for (int i = 0; i < 8; ++i) off_[i] = kDy8[i] * W_ + kDx8[i];
+}
+
+GridMap::~GridMap() { unmap_(); }
+
+GridMap::GridMap(GridMap&& o) noexcept { *this = std::move(o); }
+
+GridMap& GridMap::operator=(GridMap&& o) noexcept {
+  if (this == &o) return *this;
+  unmap_();
+  W_ = o.W_; H_ = o.H_; diag_ = o.diag_; dir_mask_ = o.dir_mask_;
+  std::memcpy(off_, o.off_, sizeof(off_));
+  // vector 이동은 버퍼를 그대로 넘기므로 bits_/nbr_ 포인터는 유효
+  bits_store_ = std::move(o.bits_store_);
+  nbr_store_  = std::move(o.nbr_store_);
+  bits_ = o.bits_; nbr_ = o.nbr_;
+  map_ = o.map_; map_len_ = o.map_len_;
+  o.bits_ = nullptr; o.nbr_ = nullptr; o.map_ = nullptr; o.map_len_ = 0;
+  return *this;
+}
+
+void GridMap::unmap_() {
+  if (map_) ::munmap(map_, map_len_);
+  map_ = nullptr; map_len_ = 0;
+}
+
+void GridMap::load_text_(const std::string& map_path) {
   std::ifstream ifs(map_path);
   if (!ifs) throw std::runtime_error("cannot open map: " + map_path);
 
@@ -19,33 +75,108 @@ GridMap::GridMap(const std::string& map_path, bool allow_diag) : diag_(allow_dia
   ifs >> tag;            // map
   if (W_ <= 0 || H_ <= 0) throw std::runtime_error("invalid size");
 
-  free_.assign((std::size_t)W_*H_, 0);
+  const std::size_t N = (std::size_t)W_*H_;
+  bits_store_.assign((N + 63) / 64, 0);
 
   std::string line; std::getline(ifs, line);
   for (int y = 0; y < H_; ++y) {
     std::getline(ifs, line);
     if ((int)line.size() < W_) throw std::runtime_error("map row too short");
-    for (int x = 0; x < W_; ++x) free_[y*W_ + x] = is_free_char(line[x]) ? 1 : 0;
+    for (int x = 0; x < W_; ++x) {
+      if (!is_free_char(line[x])) continue;
+      const std::size_t i = (std::size_t)y*W_ + x;
+      bits_store_[i >> 6] |= (uint64_t)1 << (i & 63);
+    }
   }
+  bits_ = bits_store_.data();
+  build_neighbor_masks_();
+}
+
+// magic 이 다르면 false (텍스트 .map 으로 처리), magic 은 맞는데 내용이 깨졌으면 예외
+bool GridMap::load_binary_(const std::string& map_path) {
+  const int fd = ::open(map_path.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  GmapHeader h;
+  struct stat sb;
+  if (::pread(fd, &h, sizeof(h), 0) != (ssize_t)sizeof(h) ||
+      std::memcmp(h.magic, kGmapMagic, sizeof(kGmapMagic)) != 0 ||
+      ::fstat(fd, &sb) != 0) {
+    ::close(fd);
+    return false;
+  }
+
+  const std::size_t N = (std::size_t)h.width * h.height;
+  const std::size_t bits_len = (N + 63) / 64 * sizeof(uint64_t);
+  const bool ok = h.width > 0 && h.height > 0
+               && h.width <= 0x7fffffffu && h.height <= 0x7fffffffu
+               && h.file_len == (uint64_t)sb.st_size
+               && h.bits_off % 64 == 0 && h.bits_off + bits_len <= h.file_len
+               && (h.nbr_off == 0 || (h.nbr_off % 64 == 0 && h.nbr_off + N <= h.file_len));
+  if (!ok) { ::close(fd); throw std::runtime_error("corrupt gmap: " + map_path); }
+
+  void* m = ::mmap(nullptr, (std::size_t)h.file_len, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (m == MAP_FAILED) throw std::runtime_error("cannot mmap map: " + map_path);
+
+  map_ = m;
+  map_len_ = (std::size_t)h.file_len;
+  W_ = (int)h.width; H_ = (int)h.height;
+  const char* base = static_cast<const char*>(m);
+  bits_ = reinterpret_cast<const uint64_t*>(base + h.bits_off);
+  if (h.nbr_off) nbr_ = reinterpret_cast<const uint8_t*>(base + h.nbr_off);
+  else           build_neighbor_masks_();
+  return true;
+}
+
+bool GridMap::save_binary(const std::string& path, bool with_masks) const {
+  const std::size_t N = num_nodes();
+  const std::size_t bits_len = (N + 63) / 64 * sizeof(uint64_t);
+
+  GmapHeader h{};
+  std::memcpy(h.magic, kGmapMagic, sizeof(kGmapMagic));
+  h.width = (uint32_t)W_;
+  h.height = (uint32_t)H_;
+  h.bits_off = sizeof(GmapHeader);
+  h.nbr_off = with_masks ? align64(h.bits_off + bits_len) : 0;
+  h.file_len = with_masks ? h.nbr_off + N : h.bits_off + bits_len;
+
+  // 기존 .gmap 을 MAP_SHARED 로 보고 있는 프로세스가 있을 수 있으므로 제자리에서
+  // 덮어쓰지 않음: <path>.tmp.<pid> 에 쓰고 완성 후 rename
+  const std::string tmp = path + ".tmp." + std::to_string((long)::getpid());
+  {
+    std::ofstream ofs(tmp, std::ios::binary | std::ios::trunc);
+    if (!ofs) return false;
+    static const char zeros[64] = {};
+    ofs.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    ofs.write(reinterpret_cast<const char*>(bits_), (std::streamsize)bits_len);
+    if (with_masks) {
+      ofs.write(zeros, (std::streamsize)(h.nbr_off - (h.bits_off + bits_len)));
+      ofs.write(reinterpret_cast<const char*>(nbr_), (std::streamsize)N);  // 항상 8방향 마스크
+    }
+    ofs.close();
+    if (!ofs) { ::unlink(tmp.c_str()); return false; }
+  }
+  if (::rename(tmp.c_str(), path.c_str()) != 0) { ::unlink(tmp.c_str()); return false; }
+  return true;
+}
+
+void GridMap::build_neighbor_masks_() {
+  nbr_store_.assign((std::size_t)W_*H_, 0);
+  for (int y = 0; y < H_; ++y) {
+    for (int x = 0; x < W_; ++x) {
+      if (!passable(x, y)) continue;
+      uint8_t m = 0;
+      for (int i = 0; i < 8; ++i)
+        if (passable(x + kDx8[i], y + kDy8[i])) m |= (uint8_t)(1u << i);
+      nbr_store_[(std::size_t)y*W_ + x] = m;
+    }
+  }
+  nbr_ = nbr_store_.data();
 }
 
 // ★ 여기: IGraph::EdgeCB 로 명시
 void GridMap::for_each_edge(NodeId u, IGraph::EdgeCB cb, void* ctx) const {
-  int x = (int)(u % (NodeId)W_);
-  int y = (int)(u / (NodeId)W_);
-  if (!passable(x,y)) return;
-
-  static const int dx8[8] = { 1,-1, 0, 0, 1, 1,-1,-1 };
-  static const int dy8[8] = { 0, 0, 1,-1, 1,-1, 1,-1 };
-  static const int w8[8]  = {10,10,10,10,14,14,14,14};
-
-  const int N = diag_ ? 8 : 4;
-  for (int i=0;i<N;++i){
-    int nx = x + dx8[i], ny = y + dy8[i];
-    if (!passable(nx,ny)) continue;
-    NodeId v = id(nx,ny,W_);
-    cb(v, (Cost32)w8[i], ctx);
-  }
+  for_each_neighbor(u, [cb, ctx](NodeId v, Cost32 w){ cb(v, w, ctx); });
 }
 
 } // namespace pathlab
@@ -0,0 +1,249 @@
+#include "pathlab/io/bench_report.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include "pathlab/util/stats.hpp"
+
+namespace pathlab {
+
+namespace {
+
+const char* const kCols[] = {
+  "case", "sx", "sy", "gx", "gy", "dist", "steps", "reps",
+  "min_ns", "median_ns", "mean_ns", "stddev_ns", "p90_ns", "max_ns",
+  "pq_pushes", "pq_pops", "pq_decreases", "pq_moves", "pq_scans",
+  "relaxations", "improved", "settled",
+};
+
+std::string json_str(const std::string& s) {
+  std::string o = "\"";
+  for (char c : s) {
+    if (c == '"' || c == '\\') { o += '\\'; o += c; }
+    else if ((unsigned char)c < 0x20) { char b[8]; std::snprintf(b, sizeof(b), "\\u%04x", c); o += b; }
+    else o += c;
+  }
+  return o + "\"";
+}
+
+SampleStats median_stats(const BenchRun& R) {
+  std::vector<double> v;
+  v.reserve(R.cases.size());
+  for (const auto& c : R.cases) v.push_back(c.median_ns);
+  return summarize(std::move(v));
+}
+
+} // namespace
+
+bool write_bench_csv(const std::string& path, const BenchRun& R) {
+  std::FILE* f = std::fopen(path.c_str(), "w");
+  if (!f) return false;
+  std::fprintf(f, "# map=%s scen=%s pq=%s engine=%s reps=%u warmup=%u\n",
+               R.map.c_str(), R.scen.c_str(), R.pq.c_str(), R.engine.c_str(), R.reps, R.warmup);
+  for (std::size_t i = 0; i < sizeof(kCols) / sizeof(kCols[0]); ++i)
+    std::fprintf(f, "%s%s", i ? "," : "", kCols[i]);
+  if (R.has_hw)
+    for (int e = 0; e < kNumHwEvents; ++e) std::fprintf(f, ",%s", hw_event_name((HwEvent)e));
+  std::fprintf(f, "\n");
+
+  for (const auto& c : R.cases) {
+    std::fprintf(f, "%d,%d,%d,%d,%d,%u,%u,%u,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,"
+                    "%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu",
+                 c.id, c.sx, c.sy, c.gx, c.gy, c.dist, c.steps, c.reps,
+                 c.min_ns, c.median_ns, c.mean_ns, c.stddev_ns, c.p90_ns, c.max_ns,
+                 (unsigned long long)c.pq.pushes, (unsigned long long)c.pq.pops,
+                 (unsigned long long)c.pq.decreases, (unsigned long long)c.pq.moves,
+                 (unsigned long long)c.pq.scans,
+                 (unsigned long long)c.algo.relaxations, (unsigned long long)c.algo.improved,
+                 (unsigned long long)c.algo.settled);
+    if (R.has_hw)
+      for (int e = 0; e < kNumHwEvents; ++e) {
+        if (c.hw.ok[e]) std::fprintf(f, ",%llu", (unsigned long long)c.hw.v[e]);
+        else            std::fprintf(f, ",");
+      }
+    std::fprintf(f, "\n");
+  }
+  const bool ok = (std::ferror(f) == 0);
+  std::fclose(f);
+  return ok;
+}
+
+bool write_bench_json(const std::string& path, const BenchRun& R) {
+  std::FILE* f = std::fopen(path.c_str(), "w");
+  if (!f) return false;
+  const SampleStats S = median_stats(R);
+  std::fprintf(f, "{\n  \"meta\": {\"map\": %s, \"scen\": %s, \"pq\": %s, \"engine\": %s, "
+                  "\"reps\": %u, \"warmup\": %u},\n",
+               json_str(R.map).c_str(), json_str(R.scen).c_str(),
+               json_str(R.pq).c_str(), json_str(R.engine).c_str(), R.reps, R.warmup);
+  std::fprintf(f, "  \"summary\": {\"cases\": %zu, \"min_ns\": %.1f, \"median_ns\": %.1f, "
+                  "\"p90_ns\": %.1f, \"p99_ns\": %.1f, \"max_ns\": %.1f, \"mean_ns\": %.1f, "
+                  "\"stddev_ns\": %.1f},\n",
+               S.n, S.min, S.median, S.p90, S.p99, S.max, S.mean, S.stddev);
+  std::fprintf(f, "  \"cases\": [\n");
+  for (std::size_t i = 0; i < R.cases.size(); ++i) {
+    const auto& c = R.cases[i];
+    std::fprintf(f, "    {\"case\": %d, \"start\": [%d, %d], \"goal\": [%d, %d], \"dist\": %u, "
+                    "\"steps\": %u, \"reps\": %u, "
+                    "\"time_ns\": {\"min\": %.1f, \"median\": %.1f, \"mean\": %.1f, "
+                    "\"stddev\": %.1f, \"p90\": %.1f, \"max\": %.1f}, "
+                    "\"pq\": {\"pushes\": %llu, \"pops\": %llu, \"decreases\": %llu, "
+                    "\"moves\": %llu, \"scans\": %llu}, "
+                    "\"algo\": {\"relaxations\": %llu, \"improved\": %llu, \"settled\": %llu}",
+                 c.id, c.sx, c.sy, c.gx, c.gy, c.dist, c.steps, c.reps,
+                 c.min_ns, c.median_ns, c.mean_ns, c.stddev_ns, c.p90_ns, c.max_ns,
+                 (unsigned long long)c.pq.pushes, (unsigned long long)c.pq.pops,
+                 (unsigned long long)c.pq.decreases, (unsigned long long)c.pq.moves,
+                 (unsigned long long)c.pq.scans,
+                 (unsigned long long)c.algo.relaxations, (unsigned long long)c.algo.improved,
+                 (unsigned long long)c.algo.settled);
+    if (R.has_hw) {
+      std::fprintf(f, ", \"hw\": {");
+      for (int e = 0; e < kNumHwEvents; ++e) {
+        std::fprintf(f, "%s\"%s\": ", e ? ", " : "", hw_event_name((HwEvent)e));
+        if (c.hw.ok[e]) std::fprintf(f, "%llu", (unsigned long long)c.hw.v[e]);
+        else            std::fprintf(f, "null");
+      }
+      std::fprintf(f, "}");
+    }
+    std::fprintf(f, "}%s\n", (i + 1 < R.cases.size()) ? "," : "");
+  }
+  std::fprintf(f, "  ]\n}\n");
+  const bool ok = (std::ferror(f) == 0);
+  std::fclose(f);
+  return ok;
+}
+
+BenchRun load_bench_csv(const std::string& path) {
+  std::ifstream ifs(path);
+  if (!ifs) throw std::runtime_error("cannot open bench csv: " + path);
+
+  BenchRun R;
+  std::map<std::string, int> col;
+  std::string line;
+  while (std::getline(ifs, line)) {
+    if (line.empty()) continue;
+    if (line[0] == '#') {   // 메타: key=value ...
+      std::istringstream ss(line.substr(1));
+      std::string kv;
+      while (ss >> kv) {
+        const auto eq = kv.find('=');
+        if (eq == std::string::npos) continue;
+        const std::string k = kv.substr(0, eq), v = kv.substr(eq + 1);
+        if      (k == "map")    R.map = v;
+        else if (k == "scen")   R.scen = v;
+        else if (k == "pq")     R.pq = v;
+        else if (k == "engine") R.engine = v;
+        else if (k == "reps")   R.reps = (uint32_t)std::strtoul(v.c_str(), nullptr, 10);
+        else if (k == "warmup") R.warmup = (uint32_t)std::strtoul(v.c_str(), nullptr, 10);
+      }
+      continue;
+    }
+
+    std::vector<std::string> f;
+    std::size_t b = 0;
+    for (;;) {
+      const std::size_t e = line.find(',', b);
+      f.push_back(line.substr(b, e == std::string::npos ? std::string::npos : e - b));
+      if (e == std::string::npos) break;
+      b = e + 1;
+    }
+    if (col.empty()) {   // 헤더
+      for (std::size_t i = 0; i < f.size(); ++i) col[f[i]] = (int)i;
+      for (const char* c : {"case", "dist", "reps", "median_ns", "mean_ns", "stddev_ns"})
+        if (!col.count(c)) throw std::runtime_error(std::string("bench csv missing column ") + c + ": " + path);
+      R.has_hw = col.count(hw_event_name(HwEvent::Cycles)) != 0;
+      continue;
+    }
+
+    auto get = [&](const char* name) -> const std::string* {
+      auto it = col.find(name);
+      if (it == col.end() || it->second >= (int)f.size()) return nullptr;
+      return &f[(std::size_t)it->second];
+    };
+    auto u64 = [&](const char* name) {
+      const std::string* s = get(name);
+      return s ? (uint64_t)std::strtoull(s->c_str(), nullptr, 10) : 0ull;
+    };
+    auto dbl = [&](const char* name) {
+      const std::string* s = get(name);
+      return s ? std::strtod(s->c_str(), nullptr) : 0.0;
+    };
+
+    BenchCase c;
+    c.id = (int)u64("case");
+    c.sx = (int)u64("sx"); c.sy = (int)u64("sy");
+    c.gx = (int)u64("gx"); c.gy = (int)u64("gy");
+    c.dist = (uint32_t)u64("dist"); c.steps = (uint32_t)u64("steps");
+    c.reps = (uint32_t)u64("reps");
+    c.min_ns = dbl("min_ns"); c.median_ns = dbl("median_ns"); c.mean_ns = dbl("mean_ns");
+    c.stddev_ns = dbl("stddev_ns"); c.p90_ns = dbl("p90_ns"); c.max_ns = dbl("max_ns");
+    c.pq.pushes = u64("pq_pushes"); c.pq.pops = u64("pq_pops");
+    c.pq.decreases = u64("pq_decreases"); c.pq.moves = u64("pq_moves");
+    c.pq.scans = u64("pq_scans");
+    c.algo.relaxations = u64("relaxations"); c.algo.improved = u64("improved");
+    c.algo.settled = u64("settled");
+    if (R.has_hw)
+      for (int e = 0; e < kNumHwEvents; ++e) {
+        const std::string* s = get(hw_event_name((HwEvent)e));
+        if (s && !s->empty()) { c.hw.v[e] = std::strtoull(s->c_str(), nullptr, 10); c.hw.ok[e] = true; }
+      }
+    R.cases.push_back(c);
+  }
+  if (col.empty()) throw std::runtime_error("empty bench csv: " + path);
+  return R;
+}
+
+CompareResult compare_bench(const BenchRun& base, const BenchRun& cand,
+                            const CompareOptions& opt) {
+  CompareResult out;
+  std::map<int, const BenchCase*> bi;
+  for (const auto& c : base.cases) bi[c.id] = &c;
+
+  std::vector<double> logr;
+  double sum_log = 0.0;
+  for (const auto& c : cand.cases) {
+    auto it = bi.find(c.id);
+    if (it == bi.end()) continue;
+    const BenchCase& b = *it->second;
+    if (b.sx != c.sx || b.sy != c.sy || b.gx != c.gx || b.gy != c.gy) {
+      out.error = "case " + std::to_string(c.id) + " has different endpoints (different scen?)";
+      return out;
+    }
+    CaseDelta d;
+    d.id = c.id;
+    d.base_ns = b.median_ns;
+    d.cand_ns = c.median_ns;
+    d.ratio = (b.median_ns > 0.0) ? c.median_ns / b.median_ns : 1.0;
+    d.p = welch_p2(b.mean_ns, b.stddev_ns, b.reps, c.mean_ns, c.stddev_ns, c.reps);
+    d.dist_mismatch = (b.dist != c.dist);
+    const bool sig = d.p < opt.alpha;
+    d.regression  = sig && d.ratio > 1.0 + opt.threshold;
+    d.improvement = sig && d.ratio < 1.0 / (1.0 + opt.threshold);
+    out.regressions += d.regression;
+    out.improvements += d.improvement;
+    out.dist_mismatches += d.dist_mismatch;
+    if (b.median_ns > 0.0 && c.median_ns > 0.0) {
+      const double lr = std::log(d.ratio);
+      logr.push_back(lr);
+      sum_log += lr;
+    }
+    out.cases.push_back(d);
+  }
+  if (out.cases.empty()) {
+    out.error = "no common cases";
+    return out;
+  }
+  if (!logr.empty()) out.geomean_ratio = std::exp(sum_log / (double)logr.size());
+  const SignedRankResult w = wilcoxon_signed_rank(logr);
+  out.z = w.z;
+  out.p = w.p;
+  out.regression = (out.p < opt.alpha && out.z > 0.0 && out.geomean_ratio > 1.0 + opt.threshold)
+                || out.dist_mismatches > 0;
+  return out;
+}
+
+} // namespace pathlab
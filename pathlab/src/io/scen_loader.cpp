@@ -1,37 +1,126 @@
 #include "pathlab/io/scen_loader.hpp"
-#include <fstream>
-#include <sstream>
+#include <charconv>
+#include <cstring>
 #include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace pathlab {
 
-std::vector<ScenCase> load_scen(const std::string& scen_path) {
-  std::ifstream ifs(scen_path);
-  if (!ifs) throw std::runtime_error("cannot open scen: " + scen_path);
+namespace {
 
-  std::vector<ScenCase> out;
-  std::string line; bool first = true;
-
-  while (std::getline(ifs, line)) {
-    if (line.empty()) continue;
-
-    // 첫 줄이 "version X" 면 스킵
-    if (first && line.rfind("version", 0) == 0) { first = false; continue; }
-    first = false;
-
-    std::istringstream iss(line);
-    int bucket;
-    ScenCase c;
-    // MovingAI .scen: bucket map_name map_w map_h sx sy gx gy [opt]
-    if (!(iss >> bucket >> c.map_name >> c.map_w >> c.map_h
-              >> c.sx >> c.sy >> c.gx >> c.gy)) {
-      continue; // parse 실패 라인 스킵
+inline bool is_ws(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+inline const char* skip_ws(const char* p, const char* e) {
+  while (p < e && is_ws(*p)) ++p;
+  return p;
+}
+
+template <class T>
+inline bool read_num(const char*& p, const char* e, T& v) {
+  p = skip_ws(p, e);
+  auto [q, ec] = std::from_chars(p, e, v);
+  if (ec != std::errc()) return false;
+  p = q;
+  return true;
+}
+
+} // namespace
+
+ScenReader::ScenReader(const std::string& scen_path) {
+  const int fd = ::open(scen_path.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("cannot open scen: " + scen_path);
+  struct stat sb;
+  if (::fstat(fd, &sb) != 0) {
+    ::close(fd);
+    throw std::runtime_error("cannot stat scen: " + scen_path);
+  }
+  len_ = (std::size_t)sb.st_size;
+  if (len_ > 0) {
+    map_ = ::mmap(nullptr, len_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map_ == MAP_FAILED) {
+      ::close(fd);
+      map_ = nullptr;
+      throw std::runtime_error("cannot mmap scen: " + scen_path);
     }
-    // opt(있을 수도/없을 수도)
-    if (!(iss >> c.opt)) c.opt = 0.0;
+    ::madvise(map_, len_, MADV_SEQUENTIAL);
+    begin_ = static_cast<const char*>(map_);
+    end_ = begin_ + len_;
+  }
+  ::close(fd);
+  rewind();
+}
+
+ScenReader::~ScenReader() {
+  if (map_) ::munmap(map_, len_);
+}
 
-    out.push_back(c);
+void ScenReader::rewind() {
+  cur_ = begin_;
+  // 첫 비어 있지 않은 줄이 "version X" 면 스킵
+  while (cur_ < end_ && (*cur_ == '\n' || *cur_ == '\r')) ++cur_;
+  if (end_ - cur_ >= 7 && std::memcmp(cur_, "version", 7) == 0) {
+    const char* nl = static_cast<const char*>(std::memchr(cur_, '\n', (std::size_t)(end_ - cur_)));
+    cur_ = nl ? nl + 1 : end_;
   }
+}
+
+uint32_t ScenReader::intern_(std::string_view name) {
+  auto it = ids_.find(name);
+  if (it != ids_.end()) return it->second;
+  const uint32_t id = (uint32_t)names_.size();
+  names_.push_back(name);
+  ids_.emplace(name, id);
+  return id;
+}
+
+// MovingAI .scen: bucket map_name map_w map_h sx sy gx gy [opt]
+bool ScenReader::parse_line_(const char* p, const char* e, ScenRecord& r) {
+  if (!read_num(p, e, r.bucket)) return false;
+  p = skip_ws(p, e);
+  const char* nb = p;
+  while (p < e && !is_ws(*p)) ++p;
+  if (p == nb) return false;
+  r.map_id = intern_(std::string_view(nb, (std::size_t)(p - nb)));
+  if (!read_num(p, e, r.map_w) || !read_num(p, e, r.map_h) ||
+      !read_num(p, e, r.sx) || !read_num(p, e, r.sy) ||
+      !read_num(p, e, r.gx) || !read_num(p, e, r.gy)) return false;
+  // opt(있을 수도/없을 수도)
+  if (!read_num(p, e, r.opt)) r.opt = 0.0;
+  return true;
+}
+
+bool ScenReader::next(std::vector<ScenRecord>& out, std::size_t max) {
+  out.clear();
+  while (cur_ < end_ && out.size() < max) {
+    const char* nl = static_cast<const char*>(std::memchr(cur_, '\n', (std::size_t)(end_ - cur_)));
+    const char* le = nl ? nl : end_;
+    const char* lb = cur_;
+    cur_ = nl ? nl + 1 : end_;
+    if (skip_ws(lb, le) == le) continue;   // 빈 줄
+    ScenRecord r;
+    if (parse_line_(lb, le, r)) out.push_back(r);   // parse 실패 라인 스킵
+  }
+  return !out.empty();
+}
+
+std::vector<ScenCase> load_scen(const std::string& scen_path) {
+  ScenReader R(scen_path);
+  std::vector<ScenCase> out;
+  R.for_each_batch(4096, [&](const ScenRecord* recs, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+      const ScenRecord& r = recs[i];
+      ScenCase c;
+      c.map_name = std::string(R.map_name(r.map_id));
+      c.map_w = r.map_w; c.map_h = r.map_h;
+      c.sx = r.sx; c.sy = r.sy;
+      c.gx = r.gx; c.gy = r.gy;
+      c.opt = r.opt;
+      out.push_back(std::move(c));
+    }
+  });
   return out;
 }
 
@@ -0,0 +1,437 @@
+#include "pathlab/ll/alt.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "pathlab/ll/astar.hpp"
+#include "pathlab/queues/heap_pq.hpp"
+
+namespace pathlab {
+
+namespace {
+
+constexpr char kAltMagic[8] = {'P','L','A','L','T','0','2','\0'};   // 02: 헤더를 마지막에 쓰고 rename (01 은 반쯤 찬 파일일 수 있음)
+
+struct FileHeader {
+  char     magic[8];
+  uint32_t n;
+  uint32_t k;
+  uint32_t select;
+  uint32_t reserved;
+  uint64_t hash;
+  uint64_t data_off;   // 테이블 시작 (64B 정렬), 그 앞에 landmark id k 개
+};
+
+std::size_t data_offset(uint32_t K) {
+  const std::size_t raw = sizeof(FileHeader) + (std::size_t)K * sizeof(NodeId);
+  return (raw + 63) & ~(std::size_t)63;
+}
+
+// 간선이 하나라도 있는 노드 (GridMap 의 막힌 칸 제외)
+bool active(const IGraph& G, NodeId v) {
+  bool any = false;
+  G.for_each_edge(v, [](NodeId, Cost32, void* p) { *static_cast<bool*>(p) = true; }, &any);
+  return any;
+}
+
+// 결정적 의사난수 (같은 그래프/K 면 같은 landmark → 캐시 재현 가능)
+uint64_t next_rand(uint64_t& x) {
+  x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+  return x;
+}
+
+NodeId pick_root(const IGraph& G, uint64_t& rng) {
+  const std::size_t N = G.num_nodes();
+  for (int t = 0; t < 64; ++t) {
+    const NodeId v = (NodeId)(next_rand(rng) % N);
+    if (active(G, v)) return v;
+  }
+  for (NodeId v = 0; v < (NodeId)N; ++v) if (active(G, v)) return v;
+  return SearchWorkspace::INVALID;
+}
+
+void copy_column(const SearchWorkspace& ws, std::size_t N, std::vector<Cost32>& col) {
+  col.resize(N);
+  for (NodeId v = 0; v < (NodeId)N; ++v) col[v] = ws.dist(v);
+}
+
+// 선택 단계에서 이미 구한 landmark 거리는 cols 에 남겨 테이블 생성에서 재사용
+std::vector<NodeId> select_farthest(const IGraph& G, uint32_t K,
+                                    std::vector<std::vector<Cost32>>& cols) {
+  const std::size_t N = G.num_nodes();
+  HeapPQ pq;
+  SearchWorkspace ws(N);
+  uint64_t rng = 0x9E3779B97F4A7C15ull ^ K;
+  std::vector<NodeId> L;
+
+  const NodeId r = pick_root(G, rng);
+  if (r == SearchWorkspace::INVALID) return L;
+  dijkstra_single(G, r, pq, ws);
+
+  // 첫 landmark: 임의 루트에서 가장 먼 노드
+  NodeId cur = r;
+  for (NodeId v = 0; v < (NodeId)N; ++v) {
+    const Cost32 d = ws.dist(v);
+    if (d != Key::INF && d > ws.dist(cur)) cur = v;
+  }
+  L.push_back(cur);
+
+  std::vector<Cost32> mind(N, Key::INF);
+  while (L.size() < K) {
+    dijkstra_single(G, cur, pq, ws);
+    cols.emplace_back();
+    copy_column(ws, N, cols.back());
+    NodeId best = SearchWorkspace::INVALID;
+    Cost32 bd = 0;
+    for (NodeId v = 0; v < (NodeId)N; ++v) {
+      mind[v] = std::min(mind[v], ws.dist(v));
+      if (mind[v] != Key::INF && mind[v] > bd) { bd = mind[v]; best = v; }
+    }
+    if (best == SearchWorkspace::INVALID) break;   // 남은 노드가 전부 landmark
+    L.push_back(best);
+    cur = best;
+  }
+  return L;
+}
+
+// avoid: 임의 루트 r 의 최단 경로 트리에서 weight(v) = d(r,v) - LB(r,v) 를
+// 부분 트리별로 합하고 (landmark 가 든 부분 트리는 0), 가장 무거운 자식을 따라 잎까지 내려감
+std::vector<NodeId> select_avoid(const IGraph& G, uint32_t K,
+                                 std::vector<std::vector<Cost32>>& cols) {
+  const std::size_t N = G.num_nodes();
+  HeapPQ pq;
+  SearchWorkspace ws(N);
+  uint64_t rng = 0xD1B54A32D192ED03ull ^ K;
+  std::vector<NodeId> L;
+  std::vector<uint8_t> is_lm(N, 0), has_lm(N, 0);
+  std::vector<uint64_t> size(N, 0);
+  std::vector<NodeId> order, first(N + 1), kids;
+
+  for (uint32_t attempt = 0; L.size() < K && attempt < 8 * K; ++attempt) {
+    const NodeId r = pick_root(G, rng);
+    if (r == SearchWorkspace::INVALID) break;
+    SearchView R = dijkstra_single(G, r, pq, ws);
+
+    order.clear();
+    for (NodeId v = 0; v < (NodeId)N; ++v) if (R.dist(v) != Key::INF) order.push_back(v);
+    std::sort(order.begin(), order.end(),
+              [&](NodeId a, NodeId b) { return R.dist(a) > R.dist(b); });
+
+    for (NodeId v : order) {
+      Cost32 lb = 0;
+      for (const auto& c : cols) {
+        if (c[r] == Key::INF || c[v] == Key::INF) continue;
+        lb = std::max(lb, c[r] > c[v] ? c[r] - c[v] : c[v] - c[r]);
+      }
+      size[v] = R.dist(v) - std::min(lb, R.dist(v));
+      has_lm[v] = is_lm[v];
+    }
+    // 자식 → 부모 순 (dist 내림차순) 으로 누적
+    std::fill(first.begin(), first.end(), 0u);
+    for (NodeId v : order) {
+      const NodeId p = R.parent(v);
+      if (p == SearchWorkspace::INVALID) continue;
+      size[p] += size[v];
+      has_lm[p] |= has_lm[v];
+      first[p + 1]++;
+    }
+    for (std::size_t i = 0; i < N; ++i) first[i + 1] += first[i];
+    kids.resize(first[N]);
+    {
+      std::vector<NodeId> fill(first.begin(), first.end() - 1);
+      for (NodeId v : order) {
+        const NodeId p = R.parent(v);
+        if (p != SearchWorkspace::INVALID) kids[fill[p]++] = v;
+      }
+    }
+
+    NodeId v = r;
+    for (;;) {
+      NodeId best = SearchWorkspace::INVALID;
+      for (uint32_t i = first[v]; i < first[v + 1]; ++i) {
+        const NodeId c = kids[i];
+        if (has_lm[c]) continue;
+        if (best == SearchWorkspace::INVALID || size[c] > size[best]) best = c;
+      }
+      if (best == SearchWorkspace::INVALID) break;
+      v = best;
+    }
+    if (v == r || is_lm[v]) continue;   // 이 루트로는 새 잎을 못 찾음
+
+    L.push_back(v);
+    is_lm[v] = 1;
+    dijkstra_single(G, v, pq, ws);
+    cols.emplace_back();
+    copy_column(ws, N, cols.back());
+  }
+  return L;
+}
+
+inline Cost32 alt_h(const LandmarkTable& L, const Cost32* grow, NodeId v,
+                    NodeId W, int gx, int gy, bool diag) {
+  const Cost32 ho = octile_h((int)(v % W), (int)(v / W), gx, gy, diag);
+  const Cost32 hl = L.h(v, grow);
+  return ho > hl ? ho : hl;
+}
+
+template <class F>
+void parallel_for(unsigned T, std::size_t n, F&& f) {
+  std::atomic<std::size_t> next{0};
+  auto body = [&](unsigned tid) {
+    for (;;) {
+      const std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+      if (i >= n) return;
+      f(tid, i);
+    }
+  };
+  if (T <= 1 || n <= 1) { body(0); return; }
+  std::vector<std::thread> th;
+  th.reserve(T - 1);
+  for (unsigned t = 1; t < T; ++t) th.emplace_back(body, t);
+  body(0);
+  for (auto& t : th) t.join();
+}
+
+} // namespace
+
+bool parse_landmark_select(const std::string& name, LandmarkSelect& out) {
+  if (name == "farthest") { out = LandmarkSelect::Farthest; return true; }
+  if (name == "avoid")    { out = LandmarkSelect::Avoid;    return true; }
+  return false;
+}
+
+const char* landmark_select_name(LandmarkSelect s) {
+  return s == LandmarkSelect::Avoid ? "avoid" : "farthest";
+}
+
+LandmarkTable::~LandmarkTable() { unmap_(); }
+
+LandmarkTable::LandmarkTable(LandmarkTable&& o) noexcept { *this = std::move(o); }
+
+LandmarkTable& LandmarkTable::operator=(LandmarkTable&& o) noexcept {
+  if (this == &o) return *this;
+  unmap_();
+  map_ = o.map_; map_len_ = o.map_len_; data_ = o.data_; K_ = o.K_;
+  landmarks_ = std::move(o.landmarks_);
+  o.map_ = nullptr; o.map_len_ = 0; o.data_ = nullptr; o.K_ = 0;
+  return *this;
+}
+
+void LandmarkTable::unmap_() {
+  if (map_) ::munmap(map_, map_len_);
+  map_ = nullptr; map_len_ = 0; data_ = nullptr; K_ = 0;
+  landmarks_.clear();
+}
+
+LandmarkTable LandmarkTable::build(const IGraph& G, uint32_t K, LandmarkSelect sel,
+                                   unsigned threads, const std::string& path,
+                                   ALTBuildStats* st) {
+  using clock = std::chrono::steady_clock;
+  const std::size_t N = G.num_nodes();
+  if (K == 0) throw std::runtime_error("ALT: need at least one landmark");
+  unsigned T = threads ? threads : std::thread::hardware_concurrency();
+  if (T == 0) T = 1;
+
+  // 1) 선택: 다음 landmark 가 이전 결과에 의존하므로 순차
+  auto t0 = clock::now();
+  std::vector<std::vector<Cost32>> cols;
+  std::vector<NodeId> L = (sel == LandmarkSelect::Avoid) ? select_avoid(G, K, cols)
+                                                         : select_farthest(G, K, cols);
+  if (L.empty()) throw std::runtime_error("ALT: graph has no edges");
+  K = (uint32_t)L.size();
+  auto t1 = clock::now();
+
+  // 2) 매핑 준비 (파일이 안 되면 익명 매핑)
+  //    <path>.tmp.<pid> 에 만들고 완성 후 rename → 중단되거나 동시에 빌드해도
+  //    open() 이 반쯤 찬 테이블(0 행 = 비허용 휴리스틱)을 받아들이지 않음
+  const std::size_t off = data_offset(K);
+  const std::size_t len = off + N * K * sizeof(Cost32);
+  void* m = nullptr;
+  std::string tmp;
+  if (!path.empty()) {
+    tmp = path + ".tmp." + std::to_string((long)::getpid());
+    const int fd = ::open(tmp.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0) {
+      if (::ftruncate(fd, (off_t)len) == 0) {
+        m = ::mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (m == MAP_FAILED) m = nullptr;
+      }
+      ::close(fd);
+      if (!m) ::unlink(tmp.c_str());
+    }
+    if (!m) tmp.clear();
+  }
+  if (!m) {
+    m = ::mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (m == MAP_FAILED) throw std::runtime_error("ALT: mmap failed");
+  }
+
+  std::memcpy(static_cast<char*>(m) + sizeof(FileHeader), L.data(), K * sizeof(NodeId));
+  Cost32* data = reinterpret_cast<Cost32*>(static_cast<char*>(m) + off);
+
+  // 3) 병렬: 선택 단계에서 못 구한 landmark 거리 + 노드 우선(node-major) 전치
+  const std::size_t have = cols.size();
+  cols.resize(K);
+  std::vector<HeapPQ> pqs(T);
+  std::vector<SearchWorkspace> wss(T);
+  parallel_for(T, K - have, [&](unsigned tid, std::size_t i) {
+    const std::size_t li = have + i;
+    dijkstra_single(G, L[li], pqs[tid], wss[tid]);
+    copy_column(wss[tid], N, cols[li]);
+  });
+  constexpr std::size_t kBlock = 4096;
+  parallel_for(T, (N + kBlock - 1) / kBlock, [&](unsigned, std::size_t b) {
+    const std::size_t v0 = b * kBlock, v1 = std::min(N, v0 + kBlock);
+    for (std::size_t v = v0; v < v1; ++v)
+      for (uint32_t i = 0; i < K; ++i) data[v * K + i] = cols[i][v];
+  });
+
+  // 헤더(magic 포함)는 테이블이 다 찬 뒤에 마지막으로 기록
+  FileHeader hdr{};
+  std::memcpy(hdr.magic, kAltMagic, sizeof(kAltMagic));
+  hdr.n = (uint32_t)N;
+  hdr.k = K;
+  hdr.select = (uint32_t)sel;
+  hdr.hash = graph_hash(G);
+  hdr.data_off = off;
+  std::memcpy(m, &hdr, sizeof(hdr));
+  if (!tmp.empty()) {
+    if (::msync(m, len, MS_SYNC) != 0 || ::rename(tmp.c_str(), path.c_str()) != 0)
+      ::unlink(tmp.c_str());   // 캐시만 포기 (매핑은 그대로 사용)
+  }
+  auto t2 = clock::now();
+
+  LandmarkTable out;
+  out.map_ = m;
+  out.map_len_ = len;
+  out.data_ = data;
+  out.K_ = K;
+  out.landmarks_ = std::move(L);
+  if (st) {
+    st->select_ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    st->table_ms  = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    st->threads   = T;
+  }
+  return out;
+}
+
+bool LandmarkTable::open(const std::string& path, const IGraph& G, uint32_t K,
+                         LandmarkSelect sel) {
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat sb;
+  if (::fstat(fd, &sb) != 0 || (std::size_t)sb.st_size < sizeof(FileHeader)) {
+    ::close(fd);
+    return false;
+  }
+  const std::size_t len = (std::size_t)sb.st_size;
+  void* m = ::mmap(nullptr, len, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (m == MAP_FAILED) return false;
+
+  FileHeader hdr;
+  std::memcpy(&hdr, m, sizeof(hdr));
+  const std::size_t N = G.num_nodes();
+  const bool ok = std::memcmp(hdr.magic, kAltMagic, sizeof(kAltMagic)) == 0
+               && hdr.n == N && hdr.k == K && hdr.select == (uint32_t)sel
+               && hdr.data_off == data_offset(K)
+               && len == hdr.data_off + N * K * sizeof(Cost32)
+               && hdr.hash == graph_hash(G);   // 그래프가 바뀐 캐시는 무시
+  if (!ok) { ::munmap(m, len); return false; }
+
+  unmap_();
+  map_ = m;
+  map_len_ = len;
+  data_ = reinterpret_cast<const Cost32*>(static_cast<const char*>(m) + hdr.data_off);
+  K_ = K;
+  const NodeId* ids = reinterpret_cast<const NodeId*>(static_cast<const char*>(m) + sizeof(hdr));
+  landmarks_.assign(ids, ids + K);
+  return true;
+}
+
+LandmarkTable LandmarkTable::load_or_build(const IGraph& G, const std::string& map_path,
+                                           uint32_t K, LandmarkSelect sel, unsigned threads,
+                                           bool* loaded, ALTBuildStats* st) {
+  LandmarkTable L;
+  const std::string path = cache_path(map_path);
+  if (L.open(path, G, K, sel)) {
+    if (loaded) *loaded = true;
+    return L;
+  }
+  if (loaded) *loaded = false;
+  return build(G, K, sel, threads, path, st);   // 파일을 못 만들면 익명 매핑
+}
+
+SearchView alt_single(const GridMap& G, NodeId s, NodeId g, IPQ& Q,
+                      SearchWorkspace& ws, const LandmarkTable& L) {
+  const std::size_t N = G.num_nodes();
+  ws.begin(N);
+  DijkstraMetrics am{};
+  Q.clear(); Q.reserve(N);
+
+  const NodeId W = (NodeId)G.width();
+  const int gx = (int)(g % W), gy = (int)(g / W);
+  const bool diag = G.allow_diag();
+  const bool ordered = Q.ordered();
+
+  struct Ctx {
+    NodeId u;
+    Cost32 du;
+    NodeId g;
+    NodeId W;
+    int gx, gy;
+    bool diag;
+    const LandmarkTable* L;
+    const Cost32* grow;    // goal 의 landmark 거리 (쿼리 동안 고정)
+    SearchWorkspace* ws;
+    IPQ* Q;
+    DijkstraMetrics* am;
+  } ctx{0, 0, g, W, gx, gy, diag, &L, L.row(g), &ws, &Q, &am};
+
+  ws.set(s, 0, SearchWorkspace::INVALID);
+  const Cost32 hs = alt_h(L, ctx.grow, s, W, gx, gy, diag);
+  Q.push(s, Key{hs, hs});
+
+  while (!Q.empty()) {
+    auto [u, ku] = Q.pop();
+    am.settled++;
+    if (u == g) {
+      if (ordered) break;   // 정렬 큐: 첫 settle 이 최적
+      continue;             // 비정렬 큐: 더 나은 경로가 남아 있을 수 있음
+    }
+    if (ku.primary >= ws.dist(g)) continue;
+    ctx.u = u;
+    ctx.du = ws.dist(u);
+
+    auto cb = [](NodeId v, Cost32 w, void* p){
+      auto& C = *static_cast<Ctx*>(p);
+      auto& Q = *C.Q; auto& am = *C.am;
+      am.relaxations++;
+      const uint64_t cand = (uint64_t)C.du + w;
+      if (cand >= C.ws->dist(v)) return;
+      const Cost32 hv = alt_h(*C.L, C.grow, v, C.W, C.gx, C.gy, C.diag);
+      if (cand + hv >= C.ws->dist(C.g)) return;
+      C.ws->set(v, (Cost32)cand, C.u); am.improved++;
+      Key nk{(Cost32)cand + hv, hv};
+      if (Q.contains(v)) Q.decrease(v, nk);
+      else               Q.push(v, nk);
+    };
+    G.for_each_edge(u, cb, &ctx);
+  }
+
+  return { &ws, am, Q.metrics() };
+}
+
+DijkstraResult alt_single(const GridMap& G, NodeId s, NodeId g, IPQ& Q,
+                          const LandmarkTable& L) {
+  SearchWorkspace ws(G.num_nodes());
+  return to_result(alt_single(G, s, g, Q, ws, L), G.num_nodes());
+}
+
+} // namespace pathlab
@@ -0,0 +1,68 @@
+#include "pathlab/ll/astar.hpp"
+
+namespace pathlab {
+
+SearchView astar_single(const GridMap& G, NodeId s, NodeId g, IPQ& Q,
+                        SearchWorkspace& ws) {
+  const std::size_t N = G.num_nodes();
+  ws.begin(N);
+  DijkstraMetrics am{};
+  Q.clear(); Q.reserve(N);
+
+  const NodeId W = (NodeId)G.width();
+  const int gx = (int)(g % W), gy = (int)(g / W);
+  const bool diag = G.allow_diag();
+  const bool ordered = Q.ordered();
+
+  struct Ctx {
+    NodeId u;
+    Cost32 du;
+    NodeId g;
+    NodeId W;
+    int gx, gy;
+    bool diag;
+    SearchWorkspace* ws;
+    IPQ* Q;
+    DijkstraMetrics* am;
+  } ctx{0, 0, g, W, gx, gy, diag, &ws, &Q, &am};
+
+  ws.set(s, 0, SearchWorkspace::INVALID);
+  const Cost32 hs = octile_h((int)(s % W), (int)(s / W), gx, gy, diag);
+  Q.push(s, Key{hs, hs});
+
+  while (!Q.empty()) {
+    auto [u, ku] = Q.pop();
+    am.settled++;
+    if (u == g) {
+      if (ordered) break;   // 정렬 큐: 첫 settle 이 최적
+      continue;             // 비정렬 큐: 더 나은 경로가 남아 있을 수 있음
+    }
+    if (ku.primary >= ws.dist(g)) continue; // 현재 상한으로는 개선 불가
+    ctx.u = u;
+    ctx.du = ws.dist(u);
+
+    auto cb = [](NodeId v, Cost32 w, void* p){
+      auto& C = *static_cast<Ctx*>(p);
+      auto& Q = *C.Q; auto& am = *C.am;
+      am.relaxations++;
+      const uint64_t cand = (uint64_t)C.du + w;
+      if (cand >= C.ws->dist(v)) return;
+      const Cost32 hv = octile_h((int)(v % C.W), (int)(v / C.W), C.gx, C.gy, C.diag);
+      if (cand + hv >= C.ws->dist(C.g)) return; // admissible h: goal 상한을 넘는 경로는 버림
+      C.ws->set(v, (Cost32)cand, C.u); am.improved++;
+      Key nk{(Cost32)cand + hv, hv};
+      if (Q.contains(v)) Q.decrease(v, nk);
+      else               Q.push(v, nk);
+    };
+    G.for_each_edge(u, cb, &ctx);
+  }
+
+  return { &ws, am, Q.metrics() };
+}
+
+DijkstraResult astar_single(const GridMap& G, NodeId s, NodeId g, IPQ& Q) {
+  SearchWorkspace ws(G.num_nodes());
+  return to_result(astar_single(G, s, g, Q, ws), G.num_nodes());
+}
+
+} // namespace pathlab
@@ -0,0 +1,107 @@
+#include "pathlab/ll/bidir.hpp"
+#include <algorithm>
+
+namespace pathlab {
+
+namespace {
+
+struct Side {
+  IPQ* Q;
+  SearchWorkspace* ws;
+  const SearchWorkspace* other;
+  DijkstraMetrics am;
+  uint32_t tie = 0;
+};
+
+struct Ctx {
+  Side* side;
+  NodeId u;
+  Cost32 du;
+  Cost32* mu;
+  NodeId* meet;
+};
+
+void relax_cb(NodeId v, Cost32 w, void* p) {
+  auto& C = *static_cast<Ctx*>(p);
+  Side& S = *C.side;
+  S.am.relaxations++;
+  const uint64_t cand = (uint64_t)C.du + w;
+  if (cand >= S.ws->dist(v)) return;
+  if (cand >= *C.mu) return;            // mu 를 넘는 경로는 쓸모없음
+  S.ws->set(v, (Cost32)cand, C.u); S.am.improved++;
+  const Cost32 dv = S.other->dist(v);
+  if (dv != Key::INF && cand + dv < *C.mu) { *C.mu = (Cost32)(cand + dv); *C.meet = v; }
+  Key nk{(Cost32)cand, S.tie++};
+  if (S.Q->contains(v)) S.Q->decrease(v, nk);
+  else                  S.Q->push(v, nk);
+}
+
+} // namespace
+
+BidirView bidir_single(const IGraph& G, NodeId s, NodeId g,
+                       IPQ& Qf, IPQ& Qb,
+                       SearchWorkspace& wf, SearchWorkspace& wb) {
+  const std::size_t N = G.num_nodes();
+  wf.begin(N); wb.begin(N);
+  Qf.clear(); Qf.reserve(N);
+  Qb.clear(); Qb.reserve(N);
+
+  Side F{&Qf, &wf, &wb, {}, 0};
+  Side B{&Qb, &wb, &wf, {}, 0};
+  const bool ordered = Qf.ordered() && Qb.ordered();
+
+  Cost32 mu = Key::INF;
+  NodeId meet = SearchWorkspace::INVALID;
+  wf.set(s, 0, SearchWorkspace::INVALID);
+  wb.set(g, 0, SearchWorkspace::INVALID);
+  if (s == g) { mu = 0; meet = s; }
+  else {
+    Qf.push(s, Key{0u, F.tie++});
+    Qb.push(g, Key{0u, B.tie++});
+  }
+
+  Ctx ctx{nullptr, 0, 0, &mu, &meet};
+  while (!Qf.empty() || !Qb.empty()) {
+    Side* S;
+    if (ordered) {
+      if (Qf.empty() || Qb.empty()) break;  // 한쪽이 소진되면 mu 가 최종값
+      const Cost32 tf = Qf.top().second.primary;
+      const Cost32 tb = Qb.top().second.primary;
+      if ((uint64_t)tf + tb >= mu) break;   // mu-bound
+      S = (tf <= tb) ? &F : &B;
+    } else {
+      S = Qb.empty() ? &F : Qf.empty() ? &B : (F.am.settled <= B.am.settled ? &F : &B);
+    }
+
+    auto [u, ku] = S->Q->pop();
+    S->am.settled++;
+    const Cost32 du = S->ws->dist(u);
+    if (du >= mu) continue;   // 비정렬 큐: 개선 불가 노드는 확장 생략
+
+    ctx.side = S; ctx.u = u; ctx.du = du;
+    G.for_each_edge(u, relax_cb, &ctx);
+  }
+
+  BidirView V;
+  V.fwd = &wf; V.bwd = &wb;
+  V.meet = meet; V.dist = mu;
+  V.algo_fwd = F.am; V.algo_bwd = B.am;
+  V.algo.relaxations = F.am.relaxations + B.am.relaxations;
+  V.algo.improved    = F.am.improved + B.am.improved;
+  V.algo.settled     = F.am.settled + B.am.settled;
+  V.pq = Qf.metrics();
+  V.pq += Qb.metrics();
+  return V;
+}
+
+std::vector<NodeId> BidirView::path() const {
+  std::vector<NodeId> p;
+  if (meet == SearchWorkspace::INVALID) return p;
+  for (NodeId v = meet; v != SearchWorkspace::INVALID; v = fwd->parent(v)) p.push_back(v);
+  std::reverse(p.begin(), p.end());
+  for (NodeId v = bwd->parent(meet); v != SearchWorkspace::INVALID; v = bwd->parent(v))
+    p.push_back(v);
+  return p;
+}
+
+} // namespace pathlab
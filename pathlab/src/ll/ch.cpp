@@ -0,0 +1,424 @@
+#include "pathlab/ll/ch.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+namespace pathlab {
+
+namespace {
+
+constexpr char kChMagic[8] = {'P','L','C','H','0','2','\0','\0'};   // 02: witness 가 같은 라운드 선택 노드를 피함
+// witness 탐색 settle 제한: 넘으면 witness 없음으로 보고 shortcut 추가
+// 우선순위 추정은 자주 반복되므로 작은 제한, 실제 축약은 큰 제한
+constexpr uint32_t kEstimateSettleLimit = 50;
+constexpr uint32_t kContractSettleLimit = 500;
+constexpr std::size_t kChunk = 64;
+
+struct Arc {
+  NodeId to;
+  Cost32 w;
+  NodeId mid;
+};
+
+struct Shortcut {
+  NodeId x, y;
+  Cost32 w;
+};
+
+using Adj = std::vector<std::vector<Arc>>;
+
+// 스레드별 witness 탐색 (skip 노드와 skip_set 표시 노드를 빼고 bound 이하만, settle 수 제한)
+class Witness {
+public:
+  explicit Witness(std::size_t n) : dist_(n, Key::INF), stamp_(n, 0), mark_(n, 0) {}
+
+  // targets 는 target_ 에 표시된 노드 수 (모두 settle 되면 조기 종료)
+  void run(const Adj& adj, NodeId x, NodeId skip, const uint8_t* skip_set, Cost32 bound,
+           uint32_t targets, uint32_t limit) {
+    if (++gen_ == 0) { std::fill(stamp_.begin(), stamp_.end(), 0u); gen_ = 1; }
+    heap_.clear();
+    set_(x, 0);
+    heap_.push_back({0, x});
+    uint32_t settled = 0;
+    while (!heap_.empty()) {
+      std::pop_heap(heap_.begin(), heap_.end(), std::greater<>());
+      const auto [d, u] = heap_.back();
+      heap_.pop_back();
+      if (d != dist(u)) continue;            // lazy 삭제
+      if (d > bound || settled++ >= limit) break;
+      if (mark_[u] == mark_gen_ && --targets == 0) break;
+      for (const Arc& a : adj[u]) {
+        if (a.to == skip || (skip_set && skip_set[a.to])) continue;
+        const uint64_t nd = (uint64_t)d + a.w;
+        if (nd > bound || nd >= dist(a.to)) continue;
+        set_(a.to, (Cost32)nd);
+        heap_.push_back({(Cost32)nd, a.to});
+        std::push_heap(heap_.begin(), heap_.end(), std::greater<>());
+      }
+    }
+    settled_total += settled;
+  }
+
+  Cost32 dist(NodeId v) const { return stamp_[v] == gen_ ? dist_[v] : Key::INF; }
+
+  // 다음 run 의 목표 노드 집합 초기화/표시
+  void clear_targets() {
+    if (++mark_gen_ == 0) { std::fill(mark_.begin(), mark_.end(), 0u); mark_gen_ = 1; }
+  }
+  void add_target(NodeId v) { mark_[v] = mark_gen_; }
+  void drop_target(NodeId v) { mark_[v] = 0; }
+
+  uint64_t settled_total = 0;
+
+private:
+  void set_(NodeId v, Cost32 d) { dist_[v] = d; stamp_[v] = gen_; }
+
+  std::vector<Cost32> dist_;
+  std::vector<uint32_t> stamp_;
+  uint32_t gen_ = 0;
+  std::vector<uint32_t> mark_;
+  uint32_t mark_gen_ = 0;
+  std::vector<std::pair<Cost32, NodeId>> heap_;
+};
+
+// u 를 축약할 때 필요한 shortcut 수 (out != nullptr 이면 목록도 채움, 대칭이라 x<y 쌍만)
+// skip_set: u 외에 witness 경로에서 뺄 노드 (같은 라운드에 함께 축약되는 노드)
+uint32_t simulate(const Adj& adj, NodeId u, Witness& W, std::vector<Shortcut>* out,
+                  uint32_t limit, const uint8_t* skip_set = nullptr) {
+  const auto& nb = adj[u];
+  uint32_t cnt = 0;
+  W.clear_targets();
+  for (std::size_t j = 1; j < nb.size(); ++j) W.add_target(nb[j].to);
+  for (std::size_t i = 0; i + 1 < nb.size(); ++i) {
+    Cost32 bound = 0;
+    for (std::size_t j = i + 1; j < nb.size(); ++j) bound = std::max(bound, nb[i].w + nb[j].w);
+    W.run(adj, nb[i].to, u, skip_set, bound, (uint32_t)(nb.size() - i - 1), limit);
+    for (std::size_t j = i + 1; j < nb.size(); ++j) {
+      const Cost32 req = nb[i].w + nb[j].w;
+      if (W.dist(nb[j].to) <= req) continue;
+      ++cnt;
+      if (out) out->push_back({nb[i].to, nb[j].to, req});
+    }
+    W.drop_target(nb[i + 1].to);
+  }
+  return cnt;
+}
+
+inline uint32_t mix32(uint32_t x) {
+  x ^= x >> 16; x *= 0x7feb352dU;
+  x ^= x >> 15; x *= 0x846ca68bU;
+  x ^= x >> 16;
+  return x;
+}
+
+// x→y 간선 추가 (이미 있으면 더 짧을 때만 갱신)
+bool add_arc(std::vector<Arc>& a, NodeId y, Cost32 w, NodeId mid) {
+  for (Arc& e : a) {
+    if (e.to != y) continue;
+    if (e.w <= w) return false;
+    e.w = w; e.mid = mid;
+    return true;
+  }
+  a.push_back({y, w, mid});
+  return true;
+}
+
+template <class F>
+void parallel_for(unsigned T, std::size_t n, F&& f) {
+  std::atomic<std::size_t> next{0};
+  auto body = [&](unsigned tid) {
+    for (;;) {
+      const std::size_t b = next.fetch_add(kChunk, std::memory_order_relaxed);
+      if (b >= n) return;
+      const std::size_t e = std::min(n, b + kChunk);
+      for (std::size_t i = b; i < e; ++i) f(tid, i);
+    }
+  };
+  if (T <= 1 || n <= kChunk) { body(0); return; }
+  std::vector<std::thread> th;
+  th.reserve(T - 1);
+  for (unsigned t = 1; t < T; ++t) th.emplace_back(body, t);
+  body(0);
+  for (auto& t : th) t.join();
+}
+
+struct CHSide {
+  IPQ* Q;
+  SearchWorkspace* ws;
+  const SearchWorkspace* other;
+  DijkstraMetrics am;
+  uint32_t tie = 0;
+};
+
+} // namespace
+
+CHGraph CHGraph::build(const IGraph& G, unsigned threads, CHBuildStats* st) {
+  const auto t0 = std::chrono::steady_clock::now();
+  const std::size_t N = G.num_nodes();
+  if (N >= (std::size_t)SearchWorkspace::INVALID) throw std::runtime_error("graph too large for CH");
+  unsigned T = threads ? threads : std::thread::hardware_concurrency();
+  if (T == 0) T = 1;
+
+  // 남은 그래프 (양방향 인접 리스트, 병렬 간선은 최소값 하나만)
+  Adj adj(N);
+  for (NodeId u = 0; u < (NodeId)N; ++u) {
+    struct Ctx { NodeId u; std::vector<Arc>* a; } ctx{u, &adj[u]};
+    G.for_each_edge(u, [](NodeId v, Cost32 w, void* p) {
+      auto& c = *static_cast<Ctx*>(p);
+      if (v != c.u) add_arc(*c.a, v, w, SearchWorkspace::INVALID);
+    }, &ctx);
+  }
+
+  // 우선순위 = 2*(shortcut 수 - 차수) + 축약된 이웃 수 + 깊이 (작을수록 먼저)
+  std::vector<int32_t> prio(N, 0), deleted(N, 0), depth(N, 0);
+  std::vector<uint8_t> dirty(N, 1), pick(N, 0);
+  std::vector<NodeId> rem(N);
+  std::iota(rem.begin(), rem.end(), 0u);
+  std::vector<Witness> W(T, Witness(N));
+
+  std::vector<std::vector<Arc>> up(N);
+  std::vector<uint32_t> rank(N, 0);
+  uint32_t next_rank = 0;
+  CHBuildStats S;
+  S.threads = T;
+
+  std::vector<NodeId> sel;
+  std::vector<std::vector<Shortcut>> sc;
+  // 동률은 id 해시로 (id 순이면 균일한 그리드 영역에서 모서리 한 칸만 뽑힘)
+  auto before = [&](NodeId a, NodeId b) {
+    if (prio[a] != prio[b]) return prio[a] < prio[b];
+    const uint32_t ha = mix32(a), hb = mix32(b);
+    return ha < hb || (ha == hb && a < b);
+  };
+
+  while (!rem.empty()) {
+    S.rounds++;
+    // 1) 이웃이 바뀐 노드만 우선순위 재계산
+    parallel_for(T, rem.size(), [&](unsigned tid, std::size_t i) {
+      const NodeId u = rem[i];
+      if (!dirty[u]) return;
+      dirty[u] = 0;
+      const int32_t c = (int32_t)simulate(adj, u, W[tid], nullptr, kEstimateSettleLimit);
+      prio[u] = 2 * (c - (int32_t)adj[u].size()) + deleted[u] + depth[u];
+    });
+
+    // 2) 독립 집합: 모든 남은 이웃보다 우선순위가 앞서는 노드
+    parallel_for(T, rem.size(), [&](unsigned, std::size_t i) {
+      const NodeId u = rem[i];
+      bool ok = true;
+      for (const Arc& a : adj[u]) if (!before(u, a.to)) { ok = false; break; }
+      pick[u] = ok;
+    });
+    sel.clear();
+    for (NodeId u : rem) if (pick[u]) sel.push_back(u);
+
+    // 3) shortcut 계산 (라운드 시작 시점 그래프 기준, 읽기 전용)
+    //    선택된 노드끼리 인접하지는 않지만 u1 의 witness 가 u2 를, u2 의 witness 가 u1 을
+    //    지날 수 있음 (둘 다 shortcut 을 빼면 경로가 사라짐) → 이번 라운드 선택 노드는 모두 제외
+    sc.resize(sel.size());
+    parallel_for(T, sel.size(), [&](unsigned tid, std::size_t i) {
+      sc[i].clear();
+      simulate(adj, sel[i], W[tid], &sc[i], kContractSettleLimit, pick.data());
+    });
+
+    // 4) 적용 (직렬)
+    for (std::size_t i = 0; i < sel.size(); ++i) {
+      const NodeId u = sel[i];
+      rank[u] = next_rank++;
+      up[u] = std::move(adj[u]);
+      adj[u].clear();
+      for (const Arc& a : up[u]) {
+        auto& ax = adj[a.to];
+        for (std::size_t k = 0; k < ax.size(); ++k)
+          if (ax[k].to == u) { ax[k] = ax.back(); ax.pop_back(); break; }
+        deleted[a.to]++;
+        depth[a.to] = std::max(depth[a.to], depth[u] + 1);
+        dirty[a.to] = 1;
+      }
+      for (const Shortcut& c : sc[i]) {
+        const bool a = add_arc(adj[c.x], c.y, c.w, u);
+        const bool b = add_arc(adj[c.y], c.x, c.w, u);
+        if (a || b) S.shortcuts++;
+      }
+    }
+    rem.erase(std::remove_if(rem.begin(), rem.end(), [&](NodeId u) { return pick[u] != 0; }),
+              rem.end());
+  }
+
+  CHGraph H;
+  H.hash_ = graph_hash(G);
+  H.rank_ = std::move(rank);
+  H.first_.assign(N + 1, 0);
+  for (std::size_t u = 0; u < N; ++u) H.first_[u + 1] = H.first_[u] + (uint32_t)up[u].size();
+  H.edges_.reserve(H.first_[N]);
+  for (std::size_t u = 0; u < N; ++u) {
+    std::sort(up[u].begin(), up[u].end(), [](const Arc& a, const Arc& b) { return a.to < b.to; });
+    for (const Arc& a : up[u]) H.edges_.push_back({a.to, a.w, a.mid});
+  }
+
+  for (const auto& w : W) S.witness_settled += w.settled_total;
+  S.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+  if (st) *st = S;
+  return H;
+}
+
+bool CHGraph::save(const std::string& path) const {
+  std::ofstream ofs(path, std::ios::binary);
+  if (!ofs) return false;
+  const uint32_t n = (uint32_t)rank_.size();
+  const uint64_t m = (uint64_t)edges_.size();
+  ofs.write(kChMagic, sizeof(kChMagic));
+  ofs.write(reinterpret_cast<const char*>(&n), sizeof(n));
+  ofs.write(reinterpret_cast<const char*>(&m), sizeof(m));
+  ofs.write(reinterpret_cast<const char*>(&hash_), sizeof(hash_));
+  ofs.write(reinterpret_cast<const char*>(rank_.data()), (std::streamsize)(n * sizeof(uint32_t)));
+  ofs.write(reinterpret_cast<const char*>(first_.data()), (std::streamsize)((n + 1) * sizeof(uint32_t)));
+  ofs.write(reinterpret_cast<const char*>(edges_.data()), (std::streamsize)(m * sizeof(Edge)));
+  return (bool)ofs;
+}
+
+bool CHGraph::load(const std::string& path, const IGraph& G) {
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs) return false;
+  char magic[8];
+  uint32_t n = 0;
+  uint64_t m = 0, h = 0;
+  ifs.read(magic, sizeof(magic));
+  ifs.read(reinterpret_cast<char*>(&n), sizeof(n));
+  ifs.read(reinterpret_cast<char*>(&m), sizeof(m));
+  ifs.read(reinterpret_cast<char*>(&h), sizeof(h));
+  if (!ifs || std::memcmp(magic, kChMagic, sizeof(magic)) != 0) return false;
+  if (n != G.num_nodes()) return false;
+  if (h != graph_hash(G)) return false;   // 그래프가 바뀐 캐시는 무시
+
+  std::vector<uint32_t> rank(n), first(n + 1);
+  std::vector<Edge> edges((std::size_t)m);
+  ifs.read(reinterpret_cast<char*>(rank.data()), (std::streamsize)(n * sizeof(uint32_t)));
+  ifs.read(reinterpret_cast<char*>(first.data()), (std::streamsize)((n + 1) * sizeof(uint32_t)));
+  ifs.read(reinterpret_cast<char*>(edges.data()), (std::streamsize)(m * sizeof(Edge)));
+  if (!ifs || first[n] != m) return false;
+
+  hash_ = h;
+  rank_ = std::move(rank);
+  first_ = std::move(first);
+  edges_ = std::move(edges);
+  return true;
+}
+
+CHGraph CHGraph::load_or_build(const IGraph& G, const std::string& map_path,
+                               unsigned threads, bool* loaded, CHBuildStats* st) {
+  CHGraph H;
+  const std::string path = cache_path(map_path);
+  if (H.load(path, G)) {
+    if (loaded) *loaded = true;
+    return H;
+  }
+  if (loaded) *loaded = false;
+  H = build(G, threads, st);
+  H.save(path);   // 캐시 저장 실패(읽기 전용 디렉터리 등)는 무시
+  return H;
+}
+
+void CHGraph::unpack_edge_(NodeId a, NodeId b, std::vector<NodeId>& out) const {
+  // (a,b) 간선은 rank 가 낮은 쪽의 위쪽 간선 목록에 있음
+  const NodeId lo = rank_[a] < rank_[b] ? a : b;
+  const NodeId hi = (lo == a) ? b : a;
+  const Edge* e = std::lower_bound(up_begin(lo), up_end(lo), hi,
+                                   [](const Edge& x, NodeId v) { return x.to < v; });
+  if (e == up_end(lo) || e->to != hi) throw std::runtime_error("CH: missing edge while unpacking");
+  if (e->mid == SearchWorkspace::INVALID) { out.push_back(b); return; }
+  const NodeId m = e->mid;
+  unpack_edge_(a, m, out);
+  unpack_edge_(m, b, out);
+}
+
+std::vector<NodeId> CHGraph::unpack(const std::vector<NodeId>& path) const {
+  std::vector<NodeId> out;
+  if (path.empty()) return out;
+  out.push_back(path[0]);
+  for (std::size_t i = 1; i < path.size(); ++i) unpack_edge_(path[i - 1], path[i], out);
+  return out;
+}
+
+BidirView ch_query(const CHGraph& H, NodeId s, NodeId g,
+                   IPQ& Qf, IPQ& Qb,
+                   SearchWorkspace& wf, SearchWorkspace& wb) {
+  const std::size_t N = H.num_nodes();
+  wf.begin(N); wb.begin(N);
+  Qf.clear(); Qf.reserve(N);
+  Qb.clear(); Qb.reserve(N);
+
+  CHSide F{&Qf, &wf, &wb, {}, 0};
+  CHSide B{&Qb, &wb, &wf, {}, 0};
+  const bool ordered = Qf.ordered() && Qb.ordered();
+
+  Cost32 mu = Key::INF;
+  NodeId meet = SearchWorkspace::INVALID;
+  wf.set(s, 0, SearchWorkspace::INVALID);
+  wb.set(g, 0, SearchWorkspace::INVALID);
+  if (s == g) { mu = 0; meet = s; }
+  else {
+    Qf.push(s, Key{0u, F.tie++});
+    Qb.push(g, Key{0u, B.tie++});
+  }
+
+  // 정렬 큐에서는 top >= mu 인 쪽은 더 볼 필요 없음
+  auto live = [&](const CHSide& S) {
+    if (S.Q->empty()) return false;
+    return !ordered || S.Q->top().second.primary < mu;
+  };
+
+  for (;;) {
+    const bool lf = live(F), lb = live(B);
+    if (!lf && !lb) break;
+    CHSide* S;
+    if (lf && lb) {
+      if (ordered) S = (Qf.top().second.primary <= Qb.top().second.primary) ? &F : &B;
+      else         S = (F.am.settled <= B.am.settled) ? &F : &B;
+    } else {
+      S = lf ? &F : &B;
+    }
+
+    auto [u, ku] = S->Q->pop();
+    S->am.settled++;
+    const Cost32 du = S->ws->dist(u);
+    if (du >= mu) continue;
+
+    // stall-on-demand: 더 높은 이웃을 거쳐 내려오는 경로가 더 짧으면 u 는 확장하지 않음
+    bool stalled = false;
+    for (const auto* e = H.up_begin(u); e != H.up_end(u); ++e)
+      if ((uint64_t)S->ws->dist(e->to) + e->w < du) { stalled = true; break; }
+    if (stalled) continue;
+
+    for (const auto* e = H.up_begin(u); e != H.up_end(u); ++e) {
+      const NodeId v = e->to;
+      S->am.relaxations++;
+      const uint64_t cand = (uint64_t)du + e->w;
+      if (cand >= S->ws->dist(v) || cand >= mu) continue;
+      S->ws->set(v, (Cost32)cand, u); S->am.improved++;
+      const Cost32 dv = S->other->dist(v);
+      if (dv != Key::INF && cand + dv < mu) { mu = (Cost32)(cand + dv); meet = v; }
+      Key nk{(Cost32)cand, S->tie++};
+      if (S->Q->contains(v)) S->Q->decrease(v, nk);
+      else                   S->Q->push(v, nk);
+    }
+  }
+
+  BidirView V;
+  V.fwd = &wf; V.bwd = &wb;
+  V.meet = meet; V.dist = mu;
+  V.algo_fwd = F.am; V.algo_bwd = B.am;
+  V.algo.relaxations = F.am.relaxations + B.am.relaxations;
+  V.algo.improved    = F.am.improved + B.am.improved;
+  V.algo.settled     = F.am.settled + B.am.settled;
+  V.pq = Qf.metrics();
+  V.pq += Qb.metrics();
+  return V;
+}
+
+} // namespace pathlab
@@ -0,0 +1,199 @@
+#include "pathlab/ll/delta_stepping.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "pathlab/ll/workspace.hpp"
+
+namespace pathlab {
+
+namespace {
+
+// 상위 32비트 dist, 하위 32비트 parent → 정수 비교가 곧 dist 비교
+inline uint64_t pack(Cost32 d, NodeId p) { return ((uint64_t)d << 32) | p; }
+inline Cost32 unpack_dist(uint64_t x)   { return (Cost32)(x >> 32); }
+inline NodeId unpack_parent(uint64_t x) { return (NodeId)x; }
+
+constexpr uint32_t NONE = 0xFFFFFFFFu;
+constexpr std::size_t kChunk = 64;   // 스레드가 한 번에 가져가는 노드 수
+
+// C++17 에 std::barrier 가 없어 mutex/condvar 로 구현
+class Barrier {
+public:
+  explicit Barrier(unsigned n) : n_(n) {}
+  void wait() {
+    std::unique_lock<std::mutex> lk(mu_);
+    const uint64_t g = gen_;
+    if (++count_ == n_) { count_ = 0; ++gen_; cv_.notify_all(); return; }
+    cv_.wait(lk, [&] { return gen_ != g; });
+  }
+private:
+  std::mutex mu_;
+  std::condition_variable cv_;
+  unsigned n_;
+  unsigned count_ = 0;
+  uint64_t gen_ = 0;
+};
+
+// 스레드 로컬 상태 (false sharing 방지)
+struct alignas(64) Worker {
+  std::vector<NodeId> out;   // 이번 단계에서 dist 가 줄어든 노드
+  DijkstraMetrics am;
+};
+
+struct RelaxCtx {
+  std::atomic<uint64_t>* D;
+  Worker* w;
+  NodeId u;
+  Cost32 du;
+  Cost32 delta;
+  bool light;
+};
+
+void relax_cb(NodeId v, Cost32 w, void* p) {
+  auto& C = *static_cast<RelaxCtx*>(p);
+  if ((w <= C.delta) != C.light) return;
+  C.w->am.relaxations++;
+  const uint64_t cand = (uint64_t)C.du + w;
+  if (cand >= Key::INF) return;
+  const uint64_t nv = pack((Cost32)cand, C.u);
+  uint64_t old = C.D[v].load(std::memory_order_relaxed);
+  while (unpack_dist(old) > cand) {
+    if (C.D[v].compare_exchange_weak(old, nv, std::memory_order_relaxed)) {
+      C.w->am.improved++;
+      C.w->out.push_back(v);
+      return;
+    }
+  }
+}
+
+} // namespace
+
+DijkstraResult delta_stepping(const IGraph& G, NodeId s, const DeltaOptions& opt) {
+  const std::size_t N = G.num_nodes();
+  const Cost32 delta = opt.delta ? opt.delta : 1u;
+  unsigned T = opt.threads ? opt.threads : std::thread::hardware_concurrency();
+  if (T == 0) T = 1;
+
+  std::unique_ptr<std::atomic<uint64_t>[]> D(new std::atomic<uint64_t>[N]);
+  for (std::size_t i = 0; i < N; ++i)
+    D[i].store(pack(Key::INF, SearchWorkspace::INVALID), std::memory_order_relaxed);
+  auto dist_of = [&](NodeId v) { return unpack_dist(D[v].load(std::memory_order_relaxed)); };
+
+  // 버킷 관리는 단계 사이에 스레드 0 이 직렬로 수행
+  std::vector<std::vector<NodeId>> buckets;
+  std::vector<uint32_t> inb(N, NONE);      // 노드가 마지막으로 들어간 버킷 (중복 삽입 방지)
+  std::vector<uint32_t> settled_in(N, NONE);
+  std::vector<NodeId> frontier, R;          // R: 현재 버킷에서 settle 된 노드 (heavy 단계 입력)
+  std::vector<Worker> W(T);
+  PQMetrics pm;
+  uint64_t settled = 0;
+
+  enum class Phase { Light, Heavy, Stop };
+  Phase phase = Phase::Heavy;               // 첫 setup 에서 버킷 0 을 찾도록
+  uint32_t cur = 0;
+  bool started = false;
+  std::atomic<std::size_t> cursor{0};
+
+  auto push_bucket = [&](NodeId v) {
+    const uint64_t b = dist_of(v) / delta;
+    if (inb[v] == b) return;
+    if (b >= buckets.size()) buckets.resize((std::size_t)b + 1);
+    buckets[b].push_back(v);
+    inb[v] = (uint32_t)b;
+    pm.pushes++;
+  };
+
+  // 버킷 cur 을 frontier 로 꺼냄 (낮은 버킷으로 옮겨 간 stale 항목 제거)
+  auto take = [&]() -> bool {
+    frontier.clear();
+    if (cur >= buckets.size()) return false;
+    frontier.swap(buckets[cur]);
+    buckets[cur].clear();
+    std::size_t k = 0;
+    for (NodeId v : frontier) {
+      if (inb[v] == cur) inb[v] = NONE;   // 같은 버킷으로 재삽입 허용
+      if (dist_of(v) / delta != cur) continue;
+      frontier[k++] = v;
+      if (settled_in[v] != cur) { settled_in[v] = cur; R.push_back(v); }
+    }
+    frontier.resize(k);
+    pm.pops += k;
+    return k != 0;
+  };
+
+  auto setup = [&]() {
+    for (auto& w : W) {
+      for (NodeId v : w.out) push_bucket(v);
+      w.out.clear();
+    }
+    cursor.store(0, std::memory_order_relaxed);
+    pm.scans++;
+    if (phase == Phase::Light) {
+      if (take()) return;                 // 같은 버킷을 light 로 한 번 더
+      phase = Phase::Heavy;
+      return;
+    }
+    settled += R.size();
+    R.clear();
+    if (started) ++cur;
+    started = true;
+    for (; cur < buckets.size(); ++cur)
+      if (take()) { phase = Phase::Light; return; }
+    phase = Phase::Stop;
+  };
+
+  D[s].store(pack(0, SearchWorkspace::INVALID), std::memory_order_relaxed);
+  W[0].out.push_back(s);
+
+  Barrier bar(T);
+  auto body = [&](unsigned tid) {
+    Worker& me = W[tid];
+    RelaxCtx ctx{D.get(), &me, 0, 0, delta, true};
+    for (;;) {
+      if (tid == 0) setup();
+      bar.wait();
+      if (phase == Phase::Stop) return;
+      ctx.light = (phase == Phase::Light);
+      const std::vector<NodeId>& list = ctx.light ? frontier : R;
+      for (;;) {
+        const std::size_t b = cursor.fetch_add(kChunk, std::memory_order_relaxed);
+        if (b >= list.size()) break;
+        const std::size_t e = std::min(list.size(), b + kChunk);
+        for (std::size_t i = b; i < e; ++i) {
+          ctx.u = list[i];
+          ctx.du = dist_of(ctx.u);
+          G.for_each_edge(ctx.u, relax_cb, &ctx);
+        }
+      }
+      bar.wait();
+    }
+  };
+
+  std::vector<std::thread> th;
+  th.reserve(T - 1);
+  for (unsigned t = 1; t < T; ++t) th.emplace_back(body, t);
+  body(0);
+  for (auto& t : th) t.join();
+
+  DijkstraResult out;
+  out.dist.resize(N);
+  out.parent.resize(N);
+  for (std::size_t i = 0; i < N; ++i) {
+    const uint64_t x = D[i].load(std::memory_order_relaxed);
+    out.dist[i] = unpack_dist(x);
+    out.parent[i] = unpack_parent(x);
+  }
+  for (const auto& w : W) {
+    out.algo.relaxations += w.am.relaxations;
+    out.algo.improved    += w.am.improved;
+  }
+  out.algo.settled = settled;
+  out.pq = pm;
+  return out;
+}
+
+} // namespace pathlab
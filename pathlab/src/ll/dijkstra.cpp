@@ -1,49 +1,125 @@
 #include "pathlab/ll/dijkstra.hpp"
+#include <algorithm>
 #include <limits>
 
 namespace pathlab {
 
-DijkstraResult dijkstra_single(const IGraph& G, NodeId s, IPQ& Q) {
+namespace {
+
+// goals(정렬·중복 제거) 가 비어 있으면 큐가 빌 때까지
+// L: 계측 수준 (Off 면 카운터 갱신이 모두 사라짐, Detailed 면 hist 에 분포 누적)
+template <MetricsLevel L>
+SearchView dijkstra_impl(const IGraph& G, NodeId s, const std::vector<NodeId>& goals,
+                         IPQ& Q, SearchWorkspace& ws, Cost32* radius, AlgoHistograms* hist) {
+  using AP = AlgoMetricsPolicy<L>;
   const std::size_t N = G.num_nodes();
-  std::vector<Cost32> dist(N, Key::INF);
-  std::vector<NodeId> parent(N, std::numeric_limits<NodeId>::max());
-  DijkstraMetrics am{};
+  ws.begin(N);
+  AP am(hist);
+  am.begin(N);
   Q.clear(); Q.reserve(N);
 
   uint32_t tie = 0;
-  dist[s] = 0;
+  ws.set(s, 0, SearchWorkspace::INVALID);
   Q.push(s, Key{0u, tie++});
 
+  // 개선된 이웃은 고정 버퍼에 모았다가 확장마다 push_batch 한 번 (가상 호출 1회)
+  // (차수가 kBatch 를 넘는 그래프는 찰 때마다 flush)
+  constexpr uint32_t kBatch = 32;
   struct Ctx {
     NodeId u;
-    std::vector<Cost32>* D;
-    std::vector<NodeId>* P;
+    Cost32 du;
+    uint32_t n;
+    uint32_t tie;
+    uint32_t imp;        // 이번 확장에서 개선된 이웃 수 (Detailed 만)
+    SearchWorkspace* ws;
     IPQ* Q;
-    uint32_t* tie;
-    DijkstraMetrics* am;
-  } ctx{0, &dist, &parent, &Q, &tie, &am};
+    AP* am;
+    PQItem buf[kBatch];
+  } ctx{0, 0, 0, tie, 0, &ws, &Q, &am, {}};
+
+  // 정렬 큐는 노드마다 한 번만 pop → 남은 goal 수로 종료 판정
+  std::size_t remaining = Q.ordered() ? goals.size() : 0;
+  Cost32 last = Key::INF;
 
   while (!Q.empty()) {
     auto [u, ku] = Q.pop();
-    am.settled++;
+    am.settle();
+    if constexpr (AP::kDetailed) am.observe_pop(u, ku.primary, ws.dist(u), Q.size());
+    if (remaining && std::binary_search(goals.begin(), goals.end(), u) && --remaining == 0) {
+      last = ku.primary;
+      break;
+    }
     ctx.u = u;
+    ctx.du = ws.dist(u);
 
     auto cb = [](NodeId v, Cost32 w, void* p){
       auto& C = *static_cast<Ctx*>(p);
-      auto& D = *C.D; auto& P = *C.P; auto& Q = *C.Q; auto& am = *C.am;
-      am.relaxations++;
-      const uint64_t cand = (uint64_t)D[C.u] + w;
-      if (cand < D[v]) {
-        D[v] = (Cost32)cand; P[v] = C.u; am.improved++;
-        Key nk{D[v], (*C.tie)++};
-        if (Q.contains(v)) Q.decrease(v, nk);
-        else               Q.push(v, nk);
+      auto& am = *C.am;
+      am.relax();
+      const uint64_t cand = (uint64_t)C.du + w;
+      if (cand < C.ws->dist(v)) {
+        C.ws->set(v, (Cost32)cand, C.u); am.improve();
+        if constexpr (AP::kDetailed) C.imp++;
+        if (C.n == kBatch) { C.Q->push_batch(C.buf, C.n); C.n = 0; }
+        C.buf[C.n++] = {v, Key{(Cost32)cand, C.tie++}};
       }
     };
+    ctx.n = 0;
+    if constexpr (AP::kDetailed) ctx.imp = 0;
     G.for_each_edge(u, cb, &ctx);
+    if (ctx.n) Q.push_batch(ctx.buf, ctx.n);
+    am.expanded(ctx.imp);
   }
 
-  return { std::move(dist), std::move(parent), am, Q.metrics() };
+  if (radius) *radius = last;
+  return { &ws, am.counts(), Q.metrics() };
+}
+
+const std::vector<NodeId> kNoGoals;
+
+} // namespace
+
+template <MetricsLevel L>
+SearchView dijkstra_single_m(const IGraph& G, NodeId s, IPQ& Q, SearchWorkspace& ws,
+                             AlgoHistograms* hist) {
+  return dijkstra_impl<L>(G, s, kNoGoals, Q, ws, nullptr, hist);
+}
+
+template SearchView dijkstra_single_m<MetricsLevel::Off>(
+    const IGraph&, NodeId, IPQ&, SearchWorkspace&, AlgoHistograms*);
+template SearchView dijkstra_single_m<MetricsLevel::Counters>(
+    const IGraph&, NodeId, IPQ&, SearchWorkspace&, AlgoHistograms*);
+template SearchView dijkstra_single_m<MetricsLevel::Detailed>(
+    const IGraph&, NodeId, IPQ&, SearchWorkspace&, AlgoHistograms*);
+
+SearchView dijkstra_single(const IGraph& G, NodeId s, IPQ& Q, SearchWorkspace& ws) {
+  return dijkstra_impl<kDefaultMetricsLevel>(G, s, kNoGoals, Q, ws, nullptr, nullptr);
+}
+
+SearchView dijkstra_multi(const IGraph& G, NodeId s, const NodeId* goals, std::size_t n,
+                          IPQ& Q, SearchWorkspace& ws, Cost32* radius) {
+  std::vector<NodeId> gs(goals, goals + n);
+  std::sort(gs.begin(), gs.end());
+  gs.erase(std::unique(gs.begin(), gs.end()), gs.end());
+  return dijkstra_impl<kDefaultMetricsLevel>(G, s, gs, Q, ws, radius, nullptr);
+}
+
+DijkstraResult dijkstra_single(const IGraph& G, NodeId s, IPQ& Q) {
+  SearchWorkspace ws(G.num_nodes());
+  return to_result(dijkstra_single(G, s, Q, ws), G.num_nodes());
+}
+
+DijkstraResult to_result(const SearchView& V, std::size_t n) {
+  DijkstraResult R;
+  R.dist.resize(n);
+  R.parent.resize(n);
+  for (std::size_t v = 0; v < n; ++v) {
+    R.dist[v]   = V.dist((NodeId)v);
+    R.parent[v] = V.parent((NodeId)v);
+  }
+  R.algo = V.algo;
+  R.pq   = V.pq;
+  return R;
 }
 
 } // namespace pathlab
@@ -0,0 +1,89 @@
+#include "pathlab/ll/engine.hpp"
+#include <algorithm>
+#include <optional>
+#include "pathlab/ll/astar.hpp"
+#include "pathlab/ll/jps.hpp"
+#include "pathlab/ll/alt.hpp"
+#include "pathlab/ll/dijkstra_kernel.hpp"
+#include "pathlab/queues/heap_pq.hpp"
+#include "pathlab/queues/stoc_pq.hpp"
+#include "pathlab/queues/bucket_pq.hpp"
+#include "pathlab/queues/radix_pq.hpp"
+#include "pathlab/queues/dary_heap_pq.hpp"
+
+namespace pathlab {
+
+bool parse_engine(const std::string& name, Engine& out) {
+  if (name == "dijkstra")   { out = Engine::Dijkstra;  return true; }
+  if (name == "dijkstra_t") { out = Engine::DijkstraT; return true; }
+  if (name == "astar")      { out = Engine::AStar;     return true; }
+  if (name == "jps")        { out = Engine::JPS;       return true; }
+  if (name == "jps+")       { out = Engine::JPSPlus;   return true; }
+  if (name == "alt")        { out = Engine::ALT;       return true; }
+  return false;
+}
+
+const char* engine_name(Engine e) {
+  switch (e) {
+    case Engine::Dijkstra:  return "dijkstra";
+    case Engine::DijkstraT: return "dijkstra_t";
+    case Engine::AStar:     return "astar";
+    case Engine::JPS:       return "jps";
+    case Engine::JPSPlus:   return "jps+";
+    case Engine::ALT:       return "alt";
+  }
+  return "?";
+}
+
+uint32_t engine_bucket_width(Engine e, const GridMap& G) {
+  const uint32_t max_w = G.max_edge_cost();
+  const uint32_t span  = (uint32_t)std::max(G.width(), G.height());
+  switch (e) {
+    case Engine::AStar:
+    case Engine::ALT:     return 2u * max_w;
+    case Engine::JPS:
+    case Engine::JPSPlus: return 2u * max_w * span;
+    default:              return max_w;
+  }
+}
+
+// heap/bucket/stoc 는 계측 수준마다 다른 타입 (heap@off 등) → 수준별로 판별
+template <MetricsLevel L>
+static std::optional<SearchView> run_kernel_leveled(const GridMap& G, NodeId s, IPQ& Q,
+                                                    SearchWorkspace& ws) {
+  if (auto* h = dynamic_cast<BasicHeapPQ<L>*>(&Q))   return dijkstra_kernel(G, s, *h, ws);
+  if (auto* b = dynamic_cast<BasicBucketPQ<L>*>(&Q)) return dijkstra_kernel(G, s, *b, ws);
+  if (auto* t = dynamic_cast<BasicSTOCPQ<L>*>(&Q))   return dijkstra_kernel(G, s, *t, ws);
+  return std::nullopt;
+}
+
+// 템플릿 커널: 구체 큐 타입으로 디스패치 (타입 판별은 쿼리당 1회)
+static SearchView run_kernel(const GridMap& G, NodeId s, IPQ& Q, SearchWorkspace& ws) {
+  if (auto V = run_kernel_leveled<MetricsLevel::Counters>(G, s, Q, ws)) return *V;
+  if (auto V = run_kernel_leveled<MetricsLevel::Off>(G, s, Q, ws))      return *V;
+  if (auto V = run_kernel_leveled<MetricsLevel::Detailed>(G, s, Q, ws)) return *V;
+  if (auto* r = dynamic_cast<RadixPQ*>(&Q))  return dijkstra_kernel(G, s, *r, ws);
+  if (auto* d = dynamic_cast<DaryHeapPQ<2>*>(&Q)) return dijkstra_kernel(G, s, *d, ws);
+  if (auto* d = dynamic_cast<DaryHeapPQ<4>*>(&Q)) return dijkstra_kernel(G, s, *d, ws);
+  if (auto* d = dynamic_cast<DaryHeapPQ<8>*>(&Q)) return dijkstra_kernel(G, s, *d, ws);
+  if (auto* l = dynamic_cast<LazyHeapPQ<2>*>(&Q)) return dijkstra_kernel(G, s, *l, ws);
+  if (auto* l = dynamic_cast<LazyHeapPQ<4>*>(&Q)) return dijkstra_kernel(G, s, *l, ws);
+  if (auto* l = dynamic_cast<LazyHeapPQ<8>*>(&Q)) return dijkstra_kernel(G, s, *l, ws);
+  return dijkstra_single(G, s, Q, ws);       // 알 수 없는 큐: 범용 경로
+}
+
+SearchView run_engine(Engine e, const GridMap& G, NodeId s, NodeId g,
+                      IPQ& Q, SearchWorkspace& ws, const JumpTable* jt,
+                      const LandmarkTable* lt) {
+  switch (e) {
+    case Engine::DijkstraT: return run_kernel(G, s, Q, ws);
+    case Engine::AStar:     return astar_single(G, s, g, Q, ws);
+    case Engine::JPS:       return jps_single(G, s, g, Q, ws, nullptr);
+    case Engine::JPSPlus:   return jps_single(G, s, g, Q, ws, jt);
+    case Engine::ALT:       return (lt && !lt->empty()) ? alt_single(G, s, g, Q, ws, *lt)
+                                                        : astar_single(G, s, g, Q, ws);
+    default:                return dijkstra_single(G, s, Q, ws);
+  }
+}
+
+} // namespace pathlab
@@ -0,0 +1,274 @@
+#include "pathlab/ll/jps.hpp"
+#include "pathlab/ll/astar.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace pathlab {
+
+namespace {
+
+constexpr char kJpsMagic[8] = {'P','L','J','P','S','0','1','\0'};
+
+inline int sgn(int v) { return (v > 0) - (v < 0); }
+
+// (dx,dy) → GridMap::kDx8/kDy8 방향 인덱스
+inline int dir_index(int dx, int dy) {
+  if (dy == 0) return dx > 0 ? 0 : 1;
+  if (dx == 0) return dy > 0 ? 2 : 3;
+  if (dx > 0)  return dy > 0 ? 4 : 5;
+  return dy > 0 ? 6 : 7;
+}
+
+// 코너 통과 허용 규칙 기준 forced neighbor 판정 (n 에 (dx,dy) 방향으로 도착)
+inline bool forced_straight(const GridMap& G, int x, int y, int dx, int dy) {
+  if (dy == 0)
+    return (!G.passable(x, y+1) && G.passable(x+dx, y+1)) ||
+           (!G.passable(x, y-1) && G.passable(x+dx, y-1));
+  return (!G.passable(x+1, y) && G.passable(x+1, y+dy)) ||
+         (!G.passable(x-1, y) && G.passable(x-1, y+dy));
+}
+
+inline bool forced_diag(const GridMap& G, int x, int y, int dx, int dy) {
+  return (!G.passable(x-dx, y) && G.passable(x-dx, y+dy)) ||
+         (!G.passable(x, y-dy) && G.passable(x+dx, y-dy));
+}
+
+// 온라인 점프: jump point(또는 goal)까지의 칸 수, 없으면 0
+uint32_t jump_straight(const GridMap& G, int x, int y, int dx, int dy, int gx, int gy) {
+  for (uint32_t k = 1;; ++k) {
+    x += dx; y += dy;
+    if (!G.passable(x, y)) return 0;
+    if (x == gx && y == gy) return k;
+    if (forced_straight(G, x, y, dx, dy)) return k;
+  }
+}
+
+uint32_t jump_diag(const GridMap& G, int x, int y, int dx, int dy, int gx, int gy) {
+  for (uint32_t k = 1;; ++k) {
+    x += dx; y += dy;
+    if (!G.passable(x, y)) return 0;
+    if (x == gx && y == gy) return k;
+    if (forced_diag(G, x, y, dx, dy)) return k;
+    if (jump_straight(G, x, y, dx, 0, gx, gy) || jump_straight(G, x, y, 0, dy, gx, gy))
+      return k;
+  }
+}
+
+// JPS+: 테이블 조회 + goal 이 진행 방향 범위 안이면 goal(직선)/target 점(대각)
+uint32_t jump_plus(const JumpTable& T, NodeId u, int d, int x, int y, int gx, int gy) {
+  const int k = T.at(u, d);
+  const uint32_t reach = (uint32_t)(k > 0 ? k : -k);
+  const int dx = GridMap::kDx8[d], dy = GridMap::kDy8[d];
+  if (d < 4) {
+    if (dy == 0 && gy == y && sgn(gx - x) == dx) {
+      const uint32_t t = (uint32_t)std::abs(gx - x);
+      if (t <= reach) return t;
+    } else if (dx == 0 && gx == x && sgn(gy - y) == dy) {
+      const uint32_t t = (uint32_t)std::abs(gy - y);
+      if (t <= reach) return t;
+    }
+  } else if (sgn(gx - x) == dx && sgn(gy - y) == dy) {
+    const int ax = std::abs(gx - x), ay = std::abs(gy - y);
+    const uint32_t t = (uint32_t)(ax < ay ? ax : ay);
+    if (t <= reach) return t;
+  }
+  return k > 0 ? (uint32_t)k : 0u;
+}
+
+// parent 에서 들어온 방향 기준 확장할 방향 마스크 (natural + forced)
+uint8_t successor_dirs(const GridMap& G, int x, int y, int dx, int dy) {
+  uint8_t m = 0;
+  if (dx != 0 && dy != 0) {
+    m |= (uint8_t)(1u << dir_index(dx, 0));
+    m |= (uint8_t)(1u << dir_index(0, dy));
+    m |= (uint8_t)(1u << dir_index(dx, dy));
+    if (!G.passable(x-dx, y)) m |= (uint8_t)(1u << dir_index(-dx, dy));
+    if (!G.passable(x, y-dy)) m |= (uint8_t)(1u << dir_index(dx, -dy));
+  } else if (dy == 0) {
+    m |= (uint8_t)(1u << dir_index(dx, 0));
+    if (!G.passable(x, y+1)) m |= (uint8_t)(1u << dir_index(dx, 1));
+    if (!G.passable(x, y-1)) m |= (uint8_t)(1u << dir_index(dx, -1));
+  } else {
+    m |= (uint8_t)(1u << dir_index(0, dy));
+    if (!G.passable(x+1, y)) m |= (uint8_t)(1u << dir_index(1, dy));
+    if (!G.passable(x-1, y)) m |= (uint8_t)(1u << dir_index(-1, dy));
+  }
+  return m;
+}
+
+uint64_t passability_hash(const GridMap& G) {
+  // FNV-1a over the passability bits (64 셀씩 묶어서)
+  uint64_t h = 1469598103934665603ull;
+  uint64_t word = 0; int nb = 0;
+  auto mix = [&h](uint64_t v){
+    for (int i = 0; i < 8; ++i) { h ^= (v >> (i*8)) & 0xff; h *= 1099511628211ull; }
+  };
+  for (int y = 0; y < G.height(); ++y)
+    for (int x = 0; x < G.width(); ++x) {
+      word |= (uint64_t)G.passable(x, y) << nb;
+      if (++nb == 64) { mix(word); word = 0; nb = 0; }
+    }
+  if (nb) mix(word);
+  return h;
+}
+
+} // namespace
+
+JumpTable JumpTable::build(const GridMap& G) {
+  const int W = G.width(), H = G.height();
+  if (W > 32767 || H > 32767) throw std::runtime_error("map too large for JPS+ table");
+
+  JumpTable T;
+  T.W_ = W; T.H_ = H;
+  T.hash_ = passability_hash(G);
+  T.jump_.assign((std::size_t)W * H * 8, 0);
+
+  auto at = [&T, W](int x, int y, int d) -> int16_t& {
+    return T.jump_[((std::size_t)y * W + x) * 8 + d];
+  };
+
+  // 직선(0..3) 먼저, 대각(4..7)은 직선 테이블을 참조
+  for (int d = 0; d < 8; ++d) {
+    const int dx = GridMap::kDx8[d], dy = GridMap::kDy8[d];
+    // (x+dx, y+dy) 가 (x, y) 보다 먼저 계산되도록 순회 방향 결정
+    const int y0 = dy > 0 ? H-1 : 0, y1 = dy > 0 ? -1 : H, ys = dy > 0 ? -1 : 1;
+    const int x0 = dx > 0 ? W-1 : 0, x1 = dx > 0 ? -1 : W, xs = dx > 0 ? -1 : 1;
+    for (int y = y0; y != y1; y += ys) {
+      for (int x = x0; x != x1; x += xs) {
+        if (!G.passable(x, y)) continue;
+        const int nx = x + dx, ny = y + dy;
+        if (!G.passable(nx, ny)) { at(x, y, d) = 0; continue; }
+        bool jp;
+        if (d < 4) jp = forced_straight(G, nx, ny, dx, dy);
+        else       jp = forced_diag(G, nx, ny, dx, dy)
+                        || at(nx, ny, dir_index(dx, 0)) > 0
+                        || at(nx, ny, dir_index(0, dy)) > 0;
+        if (jp) { at(x, y, d) = 1; continue; }
+        const int16_t jn = at(nx, ny, d);
+        at(x, y, d) = (int16_t)(jn > 0 ? jn + 1 : jn - 1);
+      }
+    }
+  }
+  return T;
+}
+
+bool JumpTable::save(const std::string& path) const {
+  std::ofstream ofs(path, std::ios::binary);
+  if (!ofs) return false;
+  const int32_t wh[2] = {W_, H_};
+  ofs.write(kJpsMagic, sizeof(kJpsMagic));
+  ofs.write(reinterpret_cast<const char*>(wh), sizeof(wh));
+  ofs.write(reinterpret_cast<const char*>(&hash_), sizeof(hash_));
+  ofs.write(reinterpret_cast<const char*>(jump_.data()),
+            (std::streamsize)(jump_.size() * sizeof(int16_t)));
+  return (bool)ofs;
+}
+
+bool JumpTable::load(const std::string& path, const GridMap& G) {
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs) return false;
+  char magic[8];
+  int32_t wh[2];
+  uint64_t h = 0;
+  ifs.read(magic, sizeof(magic));
+  ifs.read(reinterpret_cast<char*>(wh), sizeof(wh));
+  ifs.read(reinterpret_cast<char*>(&h), sizeof(h));
+  if (!ifs || std::memcmp(magic, kJpsMagic, sizeof(magic)) != 0) return false;
+  if (wh[0] != G.width() || wh[1] != G.height()) return false;
+  if (h != passability_hash(G)) return false;   // 맵이 바뀐 캐시는 무시
+
+  std::vector<int16_t> data((std::size_t)wh[0] * wh[1] * 8);
+  ifs.read(reinterpret_cast<char*>(data.data()),
+           (std::streamsize)(data.size() * sizeof(int16_t)));
+  if (!ifs) return false;
+
+  W_ = wh[0]; H_ = wh[1]; hash_ = h;
+  jump_ = std::move(data);
+  return true;
+}
+
+JumpTable JumpTable::load_or_build(const GridMap& G, const std::string& map_path,
+                                   bool* loaded) {
+  JumpTable T;
+  const std::string path = cache_path(map_path);
+  if (T.load(path, G)) {
+    if (loaded) *loaded = true;
+    return T;
+  }
+  if (loaded) *loaded = false;
+  T = build(G);
+  T.save(path);   // 캐시 저장 실패(읽기 전용 디렉터리 등)는 무시
+  return T;
+}
+
+SearchView jps_single(const GridMap& G, NodeId s, NodeId g, IPQ& Q,
+                      SearchWorkspace& ws, const JumpTable* plus) {
+  if (!G.allow_diag()) return astar_single(G, s, g, Q, ws);
+
+  const std::size_t N = G.num_nodes();
+  ws.begin(N);
+  DijkstraMetrics am{};
+  Q.clear(); Q.reserve(N);
+
+  const int W = G.width();
+  const int gx = (int)(g % (NodeId)W), gy = (int)(g / (NodeId)W);
+  const bool ordered = Q.ordered();
+
+  ws.set(s, 0, SearchWorkspace::INVALID);
+  const Cost32 hs = octile_h((int)(s % (NodeId)W), (int)(s / (NodeId)W), gx, gy, true);
+  Q.push(s, Key{hs, hs});
+
+  while (!Q.empty()) {
+    auto [u, ku] = Q.pop();
+    am.settled++;
+    if (u == g) {
+      if (ordered) break;
+      continue;
+    }
+    if (ku.primary >= ws.dist(g)) continue;
+
+    const int x = (int)(u % (NodeId)W), y = (int)(u / (NodeId)W);
+    const Cost32 du = ws.dist(u);
+    const NodeId p = ws.parent(u);
+    uint32_t dirs = 0xff;   // 시작 노드는 8방향 전부
+    if (p != SearchWorkspace::INVALID) {
+      const int px = (int)(p % (NodeId)W), py = (int)(p / (NodeId)W);
+      dirs = successor_dirs(G, x, y, sgn(x - px), sgn(y - py));
+    }
+
+    while (dirs) {
+      const int d = __builtin_ctz(dirs);
+      dirs &= dirs - 1;
+      const int dx = GridMap::kDx8[d], dy = GridMap::kDy8[d];
+      uint32_t t;
+      if (plus)        t = jump_plus(*plus, u, d, x, y, gx, gy);
+      else if (d < 4)  t = jump_straight(G, x, y, dx, dy, gx, gy);
+      else             t = jump_diag(G, x, y, dx, dy, gx, gy);
+      if (t == 0) continue;
+
+      am.relaxations++;
+      const int vx = x + (int)t * dx, vy = y + (int)t * dy;
+      const NodeId v = GridMap::id(vx, vy, W);
+      const uint64_t cand = (uint64_t)du + (uint64_t)t * GridMap::kW8[d];
+      if (cand >= ws.dist(v)) continue;
+      const Cost32 hv = octile_h(vx, vy, gx, gy, true);
+      if (cand + hv >= ws.dist(g)) continue;
+      ws.set(v, (Cost32)cand, u); am.improved++;
+      Key nk{(Cost32)cand + hv, hv};
+      if (Q.contains(v)) Q.decrease(v, nk);
+      else               Q.push(v, nk);
+    }
+  }
+
+  return { &ws, am, Q.metrics() };
+}
+
+DijkstraResult jps_single(const GridMap& G, NodeId s, NodeId g, IPQ& Q,
+                          const JumpTable* plus) {
+  SearchWorkspace ws(G.num_nodes());
+  return to_result(jps_single(G, s, g, Q, ws, plus), G.num_nodes());
+}
+
+} // namespace pathlab
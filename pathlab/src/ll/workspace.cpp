@@ -0,0 +1,19 @@
+#include "pathlab/ll/workspace.hpp"
+#include <algorithm>
+
+namespace pathlab {
+
+SearchWorkspace::SearchWorkspace(std::size_t n) {
+  if (n) slot_.assign(n, Slot{0, Key::INF, INVALID});
+}
+
+void SearchWorkspace::begin(std::size_t n) {
+  if (slot_.size() < n) slot_.resize(n, Slot{0, Key::INF, INVALID});
+  if (++gen_ == 0) {
+    // generation 한 바퀴: 오래된 stamp 가 새 gen 과 겹치지 않도록 전체 초기화
+    std::fill(slot_.begin(), slot_.end(), Slot{0, Key::INF, INVALID});
+    gen_ = 1;
+  }
+}
+
+} // namespace pathlab
@@ -3,97 +3,204 @@
 
 namespace pathlab {
 
-BucketPQ::BucketPQ(uint32_t max_w) : W_(max_w ? max_w : 1) {
-  K_ = W_ + 1;
-  buckets_.assign(K_, {});
+template <MetricsLevel L>
+BasicBucketPQ<L>::BasicBucketPQ(uint32_t max_w) {
+  resize_ring_(max_w ? max_w : 1);
 }
 
-void BucketPQ::reserve(std::size_t n) {
-  // reserve node-related arrays (size = n)
-  inq_.assign(n, 0);
-  key_.assign(n, Key{Key::INF, 0});
-  bidx_.assign(n, 0);
+template <MetricsLevel L>
+void BasicBucketPQ<L>::resize_ring_(uint32_t span) {
+  uint32_t K = 2;
+  while (K <= span) K <<= 1;
+  if (K <= K_ && !head_.empty()) return;
+
+  // 기존 노드를 모아 새 링에 다시 연결 (FIFO 순서는 bucket 단위로 유지)
+  std::vector<NodeId> live;
+  live.reserve(count_);
+  for (uint32_t b = 0; b < K_ && !head_.empty(); ++b)
+    for (NodeId v = head_[b]; v != NIL; v = node_[v].next) live.push_back(v);
+
+  K_ = K;
+  mask_ = K - 1;
+  head_.assign(K_, NIL);
+  tail_.assign(K_, NIL);
+  occ_.assign((K_ + 63) / 64, 0);
+  if constexpr (PQMetricsPolicy<L>::kDetailed) blen_.assign(K_, 0);
+  for (NodeId v : live) { link_(v); mp_.move(); }
 }
 
-void BucketPQ::clear() {
-  for (auto& b : buckets_) b.clear();
-  if (!inq_.empty())  std::fill(inq_.begin(), inq_.end(), 0);
+template <MetricsLevel L>
+void BasicBucketPQ<L>::reserve(std::size_t n) {
+  // grow node-related arrays only (queries reuse them; clear() resets live nodes)
+  if (inq_.size() >= n) return;
+  inq_.resize(n, 0);
+  node_.resize(n, Node{Key{Key::INF, 0}, NIL, NIL});
+}
+
+template <MetricsLevel L>
+void BasicBucketPQ<L>::clear() {
+  // only nodes still queued have inq_ set: O(count_ + K_/64)
+  for (std::size_t w = 0; w < occ_.size(); ++w) {
+    uint64_t bits = occ_[w];
+    while (bits) {
+      const uint32_t b = (uint32_t)(w * 64 + __builtin_ctzll(bits));
+      bits &= bits - 1;
+      for (NodeId v = head_[b]; v != NIL; v = node_[v].next) inq_[v] = 0;
+      head_[b] = tail_[b] = NIL;
+      if constexpr (PQMetricsPolicy<L>::kDetailed) blen_[b] = 0;
+    }
+    occ_[w] = 0;
+  }
   cur_min_ = 0;
-  offset_  = 0;
+  hi_      = 0;
+  fresh_   = true;
   count_   = 0;
-  m_ = {};
+  mp_.reset();
 }
 
-bool BucketPQ::empty() const { return count_ == 0; }
-std::size_t BucketPQ::size() const { return count_; }
+template <MetricsLevel L>
+void BasicBucketPQ<L>::admit_(Cost32 d) {
+  if (fresh_) {
+    // 첫 pop 전: 시작 키가 커도(A*의 h(s) 등) 0부터 훑지 않도록 커서를 키에 맞춤
+    if (count_ == 0) { cur_min_ = d; hi_ = d; }
+    else {
+      if (d < cur_min_) cur_min_ = d;
+      if (d > hi_)      hi_ = d;
+    }
+    if (hi_ - cur_min_ >= K_) resize_ring_(hi_ - cur_min_);
+    return;
+  }
+  assert(d >= cur_min_ && "BucketPQ requires monotone keys");
+  if (d - cur_min_ >= K_) resize_ring_(d - cur_min_);
+}
 
-void BucketPQ::push(NodeId v, Key k) {
-  if (v >= inq_.size()) reserve(v + 1);     // grow node arrays if needed
-  if (inq_[v]) { decrease(v, k); return; }  // already in queue -> treat as decrease
+template <MetricsLevel L>
+void BasicBucketPQ<L>::link_(NodeId v) {
+  const uint32_t bi = bucket_index_for(PATHLAB_KEY_COST(node_[v].key));
+  Node& n = node_[v];
+  n.next = NIL;
+  n.prev = tail_[bi];
+  if (tail_[bi] != NIL) node_[tail_[bi]].next = v;
+  else                  head_[bi] = v;
+  tail_[bi] = v;
+  occ_[bi >> 6] |= (uint64_t)1 << (bi & 63);
+  if constexpr (PQMetricsPolicy<L>::kDetailed) blen_[bi]++;
+}
 
-  key_[v] = k;
-  const uint32_t bi = bucket_index_for(PATHLAB_KEY_COST(k)); // cost % K
-  buckets_[bi].push_back(v);
-  bidx_[v] = bi;
-  inq_[v]  = 1;
-  count_  += 1;
-  m_.pushes++;
+template <MetricsLevel L>
+void BasicBucketPQ<L>::unlink_(NodeId v) {
+  const uint32_t bi = bucket_index_for(PATHLAB_KEY_COST(node_[v].key));
+  const Node& n = node_[v];
+  if (n.prev != NIL) node_[n.prev].next = n.next; else head_[bi] = n.next;
+  if (n.next != NIL) node_[n.next].prev = n.prev; else tail_[bi] = n.prev;
+  if (head_[bi] == NIL) occ_[bi >> 6] &= ~((uint64_t)1 << (bi & 63));
+  if constexpr (PQMetricsPolicy<L>::kDetailed) blen_[bi]--;
 }
 
-bool BucketPQ::contains(NodeId v) const {
-  return (v < inq_.size()) && inq_[v];
+template <MetricsLevel L>
+void BasicBucketPQ<L>::push(NodeId v, Key k) {
+  if (v >= inq_.size()) reserve((std::size_t)v + 1);  // grow node arrays if needed
+  if (inq_[v]) { decrease(v, k); return; }             // already in queue -> treat as decrease
+
+  admit_(PATHLAB_KEY_COST(k));
+  node_[v].key = k;
+  link_(v);
+  inq_[v]  = 1;
+  count_  += 1;
+  mp_.push();
 }
 
-void BucketPQ::decrease(NodeId v, Key k) {
+template <MetricsLevel L>
+void BasicBucketPQ<L>::decrease(NodeId v, Key k) {
   assert(contains(v));
-  // unlink from old bucket
-  auto& ob = buckets_[bidx_[v]];
-  for (auto it = ob.begin(); it != ob.end(); ++it) {
-    if (*it == v) { ob.erase(it); break; }
-  }
+  unlink_(v);
+  admit_(PATHLAB_KEY_COST(k));
+  node_[v].key = k;
+  link_(v);
 
-  key_[v] = k;
-  const uint32_t bi = bucket_index_for(PATHLAB_KEY_COST(k));
-  buckets_[bi].push_back(v);
-  bidx_[v] = bi;
+  mp_.decrease();
+  mp_.move(); // relink counted as a move
+}
 
-  m_.decreases++;
-  m_.moves++; // relink counted as a move
+template <MetricsLevel L>
+bool BasicBucketPQ<L>::push_or_decrease(NodeId v, Key k) {
+  if (v >= inq_.size()) reserve((std::size_t)v + 1);
+  if (inq_[v]) {
+    if (!KeyLess{}(k, node_[v].key)) return false;
+    unlink_(v);
+    admit_(PATHLAB_KEY_COST(k));
+    node_[v].key = k;
+    link_(v);
+    mp_.decrease();
+    mp_.move();
+    return true;
+  }
+  admit_(PATHLAB_KEY_COST(k));
+  node_[v].key = k;
+  link_(v);
+  inq_[v]  = 1;
+  count_  += 1;
+  mp_.push();
+  return true;
 }
 
-std::pair<NodeId, Key> BucketPQ::top() const {
-  // Dial: only look at current bucket (cur_min_ % K_); do not mutate metrics.
-  uint32_t idx = static_cast<uint32_t>(cur_min_ % K_);
-  if (buckets_[idx].empty()) return { static_cast<NodeId>(0), Key{Key::INF, 0} };
-  NodeId v = buckets_[idx].front();
-  return { v, key_[v] };
+// 같은 확장의 이웃은 키 폭이 max_w 안이므로 링 확장은 거의 없음 → 항목별 O(1) 연결
+template <MetricsLevel L>
+void BasicBucketPQ<L>::push_batch(const PQItem* items, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) push_or_decrease(items[i].u, items[i].k);
 }
 
-std::pair<NodeId, Key> BucketPQ::pop() {
-  // Dial: advance cur_min_ until its bucket has an element
-  uint32_t idx = static_cast<uint32_t>(cur_min_ % K_);
-  while (buckets_[idx].empty()) {
-    cur_min_ += 1;            // increase distance one by one
-    m_.scans++;               // count skipped empty buckets
-    idx = static_cast<uint32_t>(cur_min_ % K_);
+template <MetricsLevel L>
+uint32_t BasicBucketPQ<L>::next_occupied_(uint32_t from, uint64_t* words) const {
+  // [from, K_) 다음 [0, from) 순서로 첫 set 비트 (비어있지 않다는 전제)
+  const std::size_t nw = occ_.size();
+  std::size_t w = from >> 6;
+  uint64_t bits = occ_[w] & (~(uint64_t)0 << (from & 63));
+  for (std::size_t i = 0; i <= nw; ++i) {
+    ++*words;
+    if (bits) return (uint32_t)(w * 64 + __builtin_ctzll(bits));
+    w = (w + 1 == nw) ? 0 : w + 1;
+    bits = occ_[w];
   }
+  return from; // unreachable when count_ > 0
+}
 
-  NodeId v = buckets_[idx].front();
-  buckets_[idx].pop_front();
+template <MetricsLevel L>
+std::pair<NodeId, Key> BasicBucketPQ<L>::top() const {
+  if (count_ == 0) return { static_cast<NodeId>(0), Key{Key::INF, 0} };
+  uint64_t words = 0; // do not mutate metrics
+  const uint32_t b = next_occupied_(bucket_index_for(cur_min_), &words);
+  const NodeId v = head_[b];
+  return { v, node_[v].key };
+}
+
+template <MetricsLevel L>
+std::pair<NodeId, Key> BasicBucketPQ<L>::pop() {
+  assert(count_ > 0);
+  const uint32_t idx = bucket_index_for(cur_min_);
+  uint64_t words = 0;
+  const uint32_t b = next_occupied_(idx, &words);
+  mp_.scan(words);
+  cur_min_ += (b - idx) & mask_;           // 건너뛴 빈 bucket 만큼 커서 이동
+  fresh_ = false;
+  if constexpr (PQMetricsPolicy<L>::kDetailed) mp_.bucket_size(blen_[b]);
+
+  const NodeId v = head_[b];
+  unlink_(v);
   inq_[v] = 0;
   count_ -= 1;
-  m_.pops++;
-
-  // Note: we do NOT set cur_min_ to the popped key; Dial increases lazily above.
-  const Key kv = key_[v];
-  offset_  = static_cast<uint32_t>(cur_min_ % K_); // optional
-
-  return { v, kv };
+  mp_.pop();
+  return { v, node_[v].key };
 }
 
-std::optional<Key> BucketPQ::key_of(NodeId v) const {
+template <MetricsLevel L>
+std::optional<Key> BasicBucketPQ<L>::key_of(NodeId v) const {
   if (!contains(v)) return std::nullopt;
-  return key_[v];
+  return node_[v].key;
 }
 
+template class BasicBucketPQ<MetricsLevel::Off>;
+template class BasicBucketPQ<MetricsLevel::Counters>;
+template class BasicBucketPQ<MetricsLevel::Detailed>;
+
 } // namespace pathlab
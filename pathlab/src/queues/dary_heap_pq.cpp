@@ -0,0 +1,240 @@
+#include "pathlab/queues/dary_heap_pq.hpp"
+#include <cassert>
+
+namespace pathlab {
+
+using detail::HeapEntry;
+using detail::pack_key;
+using detail::unpack_key;
+
+// ---------------------------------------------------------------- DaryHeapPQ
+
+template <unsigned D>
+DaryHeapPQ<D>::DaryHeapPQ(std::size_t n_hint) {
+  a_.resize(kOff);
+  if (n_hint) reserve(n_hint);
+}
+
+template <unsigned D>
+void DaryHeapPQ<D>::reserve(std::size_t n) {
+  a_.reserve(kOff + n);
+  if (pos_.size() < n) pos_.resize(n, -1);
+}
+
+template <unsigned D>
+void DaryHeapPQ<D>::clear() {
+  for (std::size_t i = 0; i < n_; ++i) pos_[at_(i).u] = -1;
+  a_.resize(kOff);
+  n_ = 0;
+  m_ = {};
+}
+
+template <unsigned D>
+void DaryHeapPQ<D>::sift_up_(std::size_t i) {
+  const HeapEntry e = at_(i);
+  while (i > 0) {
+    const std::size_t p = (i - 1) / D;
+    if (!(e.k < at_(p).k)) break;
+    at_(i) = at_(p);
+    pos_[at_(i).u] = (int32_t)i;
+    m_.moves++;
+    i = p;
+  }
+  at_(i) = e;
+  pos_[e.u] = (int32_t)i;
+}
+
+template <unsigned D>
+void DaryHeapPQ<D>::sift_down_(std::size_t i) {
+  const HeapEntry e = at_(i);
+  while (true) {
+    const std::size_t c = D * i + 1;
+    if (c >= n_) break;
+    const std::size_t end = (c + D < n_) ? c + D : n_;
+    std::size_t m = c;
+    for (std::size_t j = c + 1; j < end; ++j)
+      if (at_(j).k < at_(m).k) m = j;
+    if (!(at_(m).k < e.k)) break;
+    at_(i) = at_(m);
+    pos_[at_(i).u] = (int32_t)i;
+    m_.moves++;
+    i = m;
+  }
+  at_(i) = e;
+  pos_[e.u] = (int32_t)i;
+}
+
+template <unsigned D>
+void DaryHeapPQ<D>::push(NodeId u, Key k) {
+  if (u >= pos_.size()) pos_.resize((std::size_t)u + 1, -1);
+  if (pos_[u] != -1) { decrease(u, k); return; }
+  a_.push_back(HeapEntry{pack_key(k), u, 0});
+  sift_up_(n_++);
+  m_.pushes++;
+}
+
+template <unsigned D>
+void DaryHeapPQ<D>::decrease(NodeId u, Key k) {
+  if (!contains(u)) { push(u, k); return; }
+  const std::size_t i = (std::size_t)pos_[u];
+  const uint64_t pk = pack_key(k);
+  if (!(pk < at_(i).k)) return;
+  at_(i).k = pk;
+  sift_up_(i);
+  m_.decreases++;
+}
+
+template <unsigned D>
+std::pair<NodeId, Key> DaryHeapPQ<D>::top() const {
+  assert(n_ > 0);
+  return { at_(0).u, unpack_key(at_(0).k) };
+}
+
+template <unsigned D>
+std::pair<NodeId, Key> DaryHeapPQ<D>::pop() {
+  assert(n_ > 0);
+  const HeapEntry out = at_(0);
+  pos_[out.u] = -1;
+  --n_;
+  if (n_ > 0) {
+    at_(0) = at_(n_);
+    a_.pop_back();
+    sift_down_(0);
+  } else {
+    a_.pop_back();
+  }
+  m_.pops++;
+  return { out.u, unpack_key(out.k) };
+}
+
+template <unsigned D>
+std::optional<Key> DaryHeapPQ<D>::key_of(NodeId u) const {
+  if (!contains(u)) return std::nullopt;
+  return unpack_key(at_((std::size_t)pos_[u]).k);
+}
+
+// ---------------------------------------------------------------- LazyHeapPQ
+
+template <unsigned D>
+LazyHeapPQ<D>::LazyHeapPQ(std::size_t n_hint) {
+  a_.resize(kOff);
+  if (n_hint) reserve(n_hint);
+}
+
+template <unsigned D>
+void LazyHeapPQ<D>::reserve(std::size_t n) {
+  a_.reserve(kOff + n);
+  if (best_.size() < n) best_.resize(n, kNone);
+}
+
+template <unsigned D>
+void LazyHeapPQ<D>::clear() {
+  // best_ 가 설정된 노드는 반드시 힙에 엔트리가 있음 → 엔트리만 훑음
+  for (std::size_t i = 0; i < n_; ++i) best_[at_(i).u] = kNone;
+  a_.resize(kOff);
+  n_ = 0;
+  live_ = 0;
+  m_ = {};
+}
+
+template <unsigned D>
+void LazyHeapPQ<D>::insert_(NodeId u, uint64_t k) {
+  a_.push_back(HeapEntry{k, u, 0});
+  std::size_t i = n_++;
+  const HeapEntry e = a_.back();
+  while (i > 0) {
+    const std::size_t p = (i - 1) / D;
+    if (!(e.k < at_(p).k)) break;
+    at_(i) = at_(p);
+    m_.moves++;
+    i = p;
+  }
+  at_(i) = e;
+}
+
+template <unsigned D>
+void LazyHeapPQ<D>::remove_top_() {
+  --n_;
+  if (n_ == 0) { a_.pop_back(); return; }
+  const HeapEntry e = at_(n_);
+  a_.pop_back();
+  std::size_t i = 0;
+  while (true) {
+    const std::size_t c = D * i + 1;
+    if (c >= n_) break;
+    const std::size_t end = (c + D < n_) ? c + D : n_;
+    std::size_t m = c;
+    for (std::size_t j = c + 1; j < end; ++j)
+      if (at_(j).k < at_(m).k) m = j;
+    if (!(at_(m).k < e.k)) break;
+    at_(i) = at_(m);
+    m_.moves++;
+    i = m;
+  }
+  at_(i) = e;
+}
+
+template <unsigned D>
+void LazyHeapPQ<D>::drop_stale_() {
+  while (n_ > 0 && best_[at_(0).u] != at_(0).k) {
+    remove_top_();
+    m_.moves++;   // stale 폐기
+  }
+}
+
+template <unsigned D>
+void LazyHeapPQ<D>::push(NodeId u, Key k) {
+  if (u >= best_.size()) best_.resize((std::size_t)u + 1, kNone);
+  if (best_[u] != kNone) { decrease(u, k); return; }
+  const uint64_t pk = pack_key(k);
+  best_[u] = pk;
+  insert_(u, pk);
+  live_++;
+  m_.pushes++;
+}
+
+template <unsigned D>
+void LazyHeapPQ<D>::decrease(NodeId u, Key k) {
+  if (!contains(u)) { push(u, k); return; }
+  const uint64_t pk = pack_key(k);
+  if (!(pk < best_[u])) return;
+  best_[u] = pk;       // 옛 엔트리는 stale
+  insert_(u, pk);
+  m_.decreases++;
+}
+
+template <unsigned D>
+std::pair<NodeId, Key> LazyHeapPQ<D>::top() const {
+  // const 인터페이스 요구로 내부에서 stale 정리
+  auto* self = const_cast<LazyHeapPQ*>(this);
+  self->drop_stale_();
+  assert(n_ > 0);
+  return { at_(0).u, unpack_key(at_(0).k) };
+}
+
+template <unsigned D>
+std::pair<NodeId, Key> LazyHeapPQ<D>::pop() {
+  drop_stale_();
+  assert(n_ > 0);
+  const HeapEntry out = at_(0);
+  remove_top_();
+  best_[out.u] = kNone;
+  live_--;
+  m_.pops++;
+  return { out.u, unpack_key(out.k) };
+}
+
+template <unsigned D>
+std::optional<Key> LazyHeapPQ<D>::key_of(NodeId u) const {
+  if (!contains(u)) return std::nullopt;
+  return unpack_key(best_[u]);
+}
+
+template class DaryHeapPQ<2>;
+template class DaryHeapPQ<4>;
+template class DaryHeapPQ<8>;
+template class LazyHeapPQ<2>;
+template class LazyHeapPQ<4>;
+template class LazyHeapPQ<8>;
+
+} // namespace pathlab
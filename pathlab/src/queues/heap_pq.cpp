@@ -1,88 +1,160 @@
 #include "pathlab/queues/heap_pq.hpp"
+#include <algorithm>
 #include <cassert>
 #include <utility>
 
 namespace pathlab {
 
-HeapPQ::HeapPQ(std::size_t n_hint) {
+template <MetricsLevel L>
+BasicHeapPQ<L>::BasicHeapPQ(std::size_t n_hint) {
   if (n_hint) { heap_.reserve(n_hint); pos_.assign(n_hint, -1); }
 }
 
-void HeapPQ::reserve(std::size_t n) {
+template <MetricsLevel L>
+void BasicHeapPQ<L>::reserve(std::size_t n) {
   heap_.reserve(n);
   if (pos_.size() < n) pos_.resize(n, -1);
 }
 
-void HeapPQ::clear() {
+// 남아 있는 엔트리의 pos_ 만 되돌림: O(size) (조기 종료 후에도 N 에 비례하지 않음)
+template <MetricsLevel L>
+void BasicHeapPQ<L>::clear() {
+  for (const auto& e : heap_) pos_[e.u] = -1;
   heap_.clear();
-  pos_.assign(pos_.size(), -1);
-  m_ = {};
+  mp_.reset();
 }
 
-bool HeapPQ::empty() const { return heap_.empty(); }
-std::size_t HeapPQ::size() const { return heap_.size(); }
-
-bool HeapPQ::less_(int a, int b) const {
+template <MetricsLevel L>
+bool BasicHeapPQ<L>::less_(int a, int b) const {
   const auto& A = heap_[a].k; const auto& B = heap_[b].k;
   if (A.primary != B.primary) return A.primary < B.primary;
   return A.tie < B.tie;
 }
 
-void HeapPQ::swap_(int a, int b) {
+template <MetricsLevel L>
+void BasicHeapPQ<L>::swap_(int a, int b) {
   std::swap(heap_[a], heap_[b]);
   pos_[heap_[a].u] = a; pos_[heap_[b].u] = b;
-  m_.moves += 2;
+  mp_.move(2);
 }
 
-void HeapPQ::sift_up_(int i) {
+template <MetricsLevel L>
+void BasicHeapPQ<L>::sift_up_(int i) {
+  uint32_t lv = 0;
   while (i > 0) {
     int p = (i - 1) >> 1;
     if (!less_(i, p)) break;
-    swap_(i, p); i = p;
+    swap_(i, p); i = p; ++lv;
   }
+  mp_.sift_levels(lv);
 }
 
-void HeapPQ::sift_down_(int i) {
+template <MetricsLevel L>
+void BasicHeapPQ<L>::sift_down_(int i) {
   int n = (int)heap_.size();
+  uint32_t lv = 0;
   while (true) {
     int l = (i<<1)+1, r = l+1, m = i;
     if (l < n && less_(l, m)) m = l;
     if (r < n && less_(r, m)) m = r;
     if (m == i) break;
-    swap_(i, m); i = m;
+    swap_(i, m); i = m; ++lv;
   }
+  mp_.sift_levels(lv);
 }
 
-void HeapPQ::ensure_pos_size_(std::size_t n){
+template <MetricsLevel L>
+void BasicHeapPQ<L>::ensure_pos_size_(std::size_t n){
   if (pos_.size() <= n) pos_.resize(n+1, -1);
 }
 
-void HeapPQ::push(NodeId u, Key k) {
+template <MetricsLevel L>
+void BasicHeapPQ<L>::push(NodeId u, Key k) {
   ensure_pos_size_(u);
   if (pos_[u] != -1) { decrease(u, k); return; }
   int idx = (int)heap_.size();
   heap_.push_back({u,k});
   pos_[u] = idx;
   sift_up_(idx);
-  m_.pushes++;
+  mp_.push();
 }
 
-void HeapPQ::decrease(NodeId u, Key k) {
+template <MetricsLevel L>
+void BasicHeapPQ<L>::decrease(NodeId u, Key k) {
   ensure_pos_size_(u);
   int idx = pos_[u];
   if (idx == -1) { push(u, k); return; }
   if (k.primary == heap_[idx].k.primary && k.tie >= heap_[idx].k.tie) return;
   heap_[idx].k = k;
   sift_up_(idx);
-  m_.decreases++;
+  mp_.decrease();
+}
+
+template <MetricsLevel L>
+bool BasicHeapPQ<L>::push_or_decrease(NodeId u, Key k) {
+  ensure_pos_size_(u);
+  const int idx = pos_[u];
+  if (idx == -1) {
+    const int i = (int)heap_.size();
+    heap_.push_back({u, k});
+    pos_[u] = i;
+    sift_up_(i);
+    mp_.push();
+    return true;
+  }
+  if (!KeyLess{}(k, heap_[idx].k)) return false;
+  heap_[idx].k = k;
+  sift_up_(idx);
+  mp_.decrease();
+  return true;
+}
+
+// decrease 는 제자리 sift-up, 새 엔트리는 모두 뒤에 붙인 뒤
+// - 새 엔트리가 기존 힙보다 많으면: 새 엔트리와 그 조상들만 인덱스 내림차순으로
+//   sift-down (Floyd heapify 를 영향 받는 노드로 제한)
+// - 아니면 항목별 sift-up (Dijkstra 의 새 키는 보통 부모 이상 → 비교 1회로 끝남,
+//   조상 구간 heapify 는 레벨마다 자식 2개 비교라 오히려 느림)
+template <MetricsLevel L>
+void BasicHeapPQ<L>::push_batch(const PQItem* items, std::size_t n) {
+  const int base = (int)heap_.size();
+  for (std::size_t i = 0; i < n; ++i) {
+    const NodeId u = items[i].u;
+    ensure_pos_size_(u);
+    const int idx = pos_[u];
+    if (idx == -1) {
+      pos_[u] = (int)heap_.size();
+      heap_.push_back({u, items[i].k});
+      mp_.push();
+    } else if (KeyLess{}(items[i].k, heap_[idx].k)) {
+      heap_[idx].k = items[i].k;
+      if (idx < base) sift_up_(idx);   // base 위쪽만 움직이므로 새 엔트리 위치는 그대로
+      mp_.decrease();                  // (이번 배치의 새 엔트리면 아래 heapify 에서 정리)
+    }
+  }
+  int lo = base, hi = (int)heap_.size() - 1;
+  if (hi < lo) return;
+  if (hi - lo + 1 <= base) {
+    for (int i = lo; i <= hi; ++i) sift_up_(i);
+    return;
+  }
+  int next = hi;   // 레벨 구간이 겹치면 이미 처리한 인덱스는 건너뜀
+  while (true) {
+    for (int i = std::min(hi, next); i >= lo; --i) sift_down_(i);
+    if (lo == 0) break;
+    next = lo - 1;
+    lo = (lo - 1) >> 1;
+    hi = (hi - 1) >> 1;
+  }
 }
 
-std::pair<NodeId, Key> HeapPQ::top() const {
+template <MetricsLevel L>
+std::pair<NodeId, Key> BasicHeapPQ<L>::top() const {
   assert(!heap_.empty());
   return { heap_.front().u, heap_.front().k };
 }
 
-std::pair<NodeId, Key> HeapPQ::pop() {
+template <MetricsLevel L>
+std::pair<NodeId, Key> BasicHeapPQ<L>::pop() {
   assert(!heap_.empty());
   auto out = heap_.front();
   int n = (int)heap_.size();
@@ -95,17 +167,18 @@ std::pair<NodeId, Key> HeapPQ::pop() {
     heap_.pop_back();
     sift_down_(0);
   }
-  m_.pops++;
+  mp_.pop();
   return { out.u, out.k };
 }
 
-bool HeapPQ::contains(NodeId u) const {
-  return (u < pos_.size()) && (pos_[u] != -1);
-}
-
-std::optional<Key> HeapPQ::key_of(NodeId u) const {
+template <MetricsLevel L>
+std::optional<Key> BasicHeapPQ<L>::key_of(NodeId u) const {
   if (!contains(u)) return std::nullopt;
   return heap_[pos_[u]].k;
 }
 
+template class BasicHeapPQ<MetricsLevel::Off>;
+template class BasicHeapPQ<MetricsLevel::Counters>;
+template class BasicHeapPQ<MetricsLevel::Detailed>;
+
 } // namespace pathlab
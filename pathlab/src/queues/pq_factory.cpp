@@ -0,0 +1,73 @@
+#include "pathlab/queues/pq_factory.hpp"
+#include "pathlab/queues/heap_pq.hpp"
+#include "pathlab/queues/stoc_pq.hpp"
+#include "pathlab/queues/bucket_pq.hpp"
+#include "pathlab/queues/radix_pq.hpp"
+#include "pathlab/queues/dary_heap_pq.hpp"
+#include "pathlab/queues/pq_profile.hpp"
+
+namespace pathlab {
+
+namespace {
+
+// 계측 수준을 템플릿 인자로 받는 큐만 (heap/stoc*/bucket). 그 외 이름은 nullptr
+template <MetricsLevel L>
+std::unique_ptr<IPQ> make_leveled(const std::string& name, uint32_t stoc_block, uint32_t bucket_w) {
+  if (name == "heap")   return std::make_unique<BasicHeapPQ<L>>();
+  if (name == "stoc")   return std::make_unique<BasicSTOCPQ<L>>(stoc_block);
+  if (name == "stoc_radix")
+    return std::make_unique<BasicSTOCPQ<L>>(stoc_block, Key::INF, StocSortKernel::Radix);
+  if (name == "stoc_net")
+    return std::make_unique<BasicSTOCPQ<L>>(stoc_block, Key::INF, StocSortKernel::Network);
+  if (name == "bucket") return std::make_unique<BasicBucketPQ<L>>(bucket_w);
+  return nullptr;
+}
+
+} // namespace
+
+std::unique_ptr<IPQ> make_pq(const std::string& name,
+                             uint32_t stoc_block,
+                             uint32_t bucket_w) {
+  const auto at = name.find('@');
+  if (at != std::string::npos) {
+    const std::string base = name.substr(0, at);
+    MetricsLevel lv;
+    if (!parse_metrics_level(name.substr(at + 1), lv)) return make_pq(base, stoc_block, bucket_w);
+    std::unique_ptr<IPQ> q;
+    switch (lv) {
+      case MetricsLevel::Off:      q = make_leveled<MetricsLevel::Off>(base, stoc_block, bucket_w); break;
+      case MetricsLevel::Counters: q = make_leveled<MetricsLevel::Counters>(base, stoc_block, bucket_w); break;
+      case MetricsLevel::Detailed: q = make_leveled<MetricsLevel::Detailed>(base, stoc_block, bucket_w); break;
+    }
+    return q ? std::move(q) : make_pq(base, stoc_block, bucket_w);
+  }
+  if (name == "heap")   return std::make_unique<HeapPQ>();
+  if (name == "stoc")   return std::make_unique<STOCPQ>(stoc_block);
+  if (name == "stoc_radix")
+    return std::make_unique<STOCPQ>(stoc_block, Key::INF, STOCPQ::SortKernel::Radix);
+  if (name == "stoc_net")
+    return std::make_unique<STOCPQ>(stoc_block, Key::INF, STOCPQ::SortKernel::Network);
+  if (name == "bucket") return std::make_unique<BucketPQ>(bucket_w);
+  if (name == "radix")  return std::make_unique<RadixPQ>();
+  if (name == "dary2")  return std::make_unique<DaryHeapPQ<2>>();
+  if (name == "dary4")  return std::make_unique<DaryHeapPQ<4>>();
+  if (name == "dary8")  return std::make_unique<DaryHeapPQ<8>>();
+  if (name == "lazy2")  return std::make_unique<LazyHeapPQ<2>>();
+  if (name == "lazy4")  return std::make_unique<LazyHeapPQ<4>>();
+  if (name == "lazy8")  return std::make_unique<LazyHeapPQ<8>>();
+  // 기본은 heap
+  return std::make_unique<HeapPQ>();
+}
+
+std::unique_ptr<IPQ> make_pq(const std::string& name,
+                             uint32_t stoc_block,
+                             uint32_t bucket_w,
+                             const std::string& map_path,
+                             const std::string& engine,
+                             uint64_t graph_hash) {
+  std::string n = name;
+  resolve_auto_pq(map_path, engine, graph_hash, n, stoc_block);
+  return make_pq(n, stoc_block, bucket_w);
+}
+
+} // namespace pathlab
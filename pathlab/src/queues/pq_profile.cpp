@@ -0,0 +1,66 @@
+#include "pathlab/queues/pq_profile.hpp"
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace pathlab {
+
+namespace {
+constexpr const char* kProfileHeader = "# pathlab pq profile v2";
+}
+
+bool PQProfile::load(const std::string& path) {
+  std::ifstream ifs(path);
+  if (!ifs) return false;
+  std::string line;
+  if (!std::getline(ifs, line) || line != kProfileHeader) return false;
+  std::vector<PQProfileEntry> out;
+  while (std::getline(ifs, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream ss(line);
+    PQProfileEntry e;
+    if (!(ss >> e.engine >> std::hex >> e.graph_hash >> std::dec
+             >> e.pq >> e.stoc_block >> e.ns_per_query >> e.samples)) return false;
+    out.push_back(std::move(e));
+  }
+  entries_ = std::move(out);
+  return true;
+}
+
+bool PQProfile::save(const std::string& path) const {
+  std::ofstream ofs(path);
+  if (!ofs) return false;
+  ofs << kProfileHeader << "\n" << std::fixed << std::setprecision(1);
+  for (const auto& e : entries_)
+    ofs << e.engine << ' ' << std::hex << e.graph_hash << std::dec << ' '
+        << e.pq << ' ' << e.stoc_block << ' '
+        << e.ns_per_query << ' ' << e.samples << "\n";
+  return (bool)ofs;
+}
+
+const PQProfileEntry* PQProfile::find(const std::string& engine, uint64_t graph_hash) const {
+  for (const auto& e : entries_)
+    if (e.engine == engine && e.graph_hash == graph_hash) return &e;
+  return nullptr;
+}
+
+void PQProfile::set(const PQProfileEntry& e) {
+  for (auto& x : entries_)
+    if (x.engine == e.engine && x.graph_hash == e.graph_hash) { x = e; return; }
+  entries_.push_back(e);
+}
+
+bool resolve_auto_pq(const std::string& map_path, const std::string& engine, uint64_t graph_hash,
+                     std::string& name, uint32_t& stoc_block) {
+  if (name != "auto") return false;
+  name = "heap";
+  PQProfile P;
+  if (!P.load(PQProfile::cache_path(map_path))) return false;
+  const PQProfileEntry* e = P.find(engine, graph_hash);   // 다른 그래프로 잰 항목은 무시
+  if (!e) return false;
+  name = e->pq;
+  stoc_block = e->stoc_block;
+  return true;
+}
+
+} // namespace pathlab
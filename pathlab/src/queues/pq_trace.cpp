@@ -0,0 +1,198 @@
+#include "pathlab/queues/pq_trace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace pathlab {
+
+namespace {
+
+constexpr char kTraceMagic[8] = {'P','L','P','Q','T','R','1','\0'};
+constexpr std::size_t kBufRecs = 1u << 16;
+
+struct TraceHeader {
+  char     magic[8];
+  uint64_t count;
+  uint32_t flags;      // bit0: unordered
+  uint32_t rec_size;
+  uint64_t reserved;
+};
+static_assert(sizeof(TraceHeader) == 32, "trace header must stay 32 bytes");
+
+} // namespace
+
+const char* pq_op_name(PQOp op) {
+  switch (op) {
+    case PQOp::Push:     return "push";
+    case PQOp::Decrease: return "decrease";
+    case PQOp::Pop:      return "pop";
+    case PQOp::Contains: return "contains";
+    case PQOp::Clear:    return "clear";
+    case PQOp::Reserve:  return "reserve";
+  }
+  return "?";
+}
+
+TracingPQ::TracingPQ(IPQ& inner, const std::string& path)
+    : q_(inner), path_(path), unordered_(!inner.ordered()) {
+  f_ = std::fopen(path.c_str(), "wb");
+  if (!f_) throw std::runtime_error("cannot open trace: " + path);
+  TraceHeader h{};   // count 는 finish() 에서 채움
+  std::fwrite(&h, sizeof(h), 1, f_);
+  buf_.reserve(kBufRecs);
+}
+
+TracingPQ::~TracingPQ() { finish(); }
+
+void TracingPQ::rec_(PQOp op, NodeId u, Cost32 c, uint32_t t) const {
+  if (u > PQTraceRec::kNodeMask) throw std::runtime_error("trace: node id exceeds 29 bits");
+  buf_.push_back({((uint32_t)op << PQTraceRec::kNodeBits) | u, c, t});
+  if (buf_.size() == kBufRecs) flush_();
+}
+
+void TracingPQ::flush_() const {
+  if (!f_ || buf_.empty()) return;
+  std::fwrite(buf_.data(), sizeof(PQTraceRec), buf_.size(), f_);
+  count_ += buf_.size();
+  buf_.clear();
+}
+
+void TracingPQ::finish() {
+  if (!f_) return;
+  flush_();
+  TraceHeader h{};
+  std::memcpy(h.magic, kTraceMagic, sizeof(kTraceMagic));
+  h.count = count_;
+  h.flags = unordered_ ? 1u : 0u;
+  h.rec_size = (uint32_t)sizeof(PQTraceRec);
+  std::fseek(f_, 0, SEEK_SET);
+  std::fwrite(&h, sizeof(h), 1, f_);
+  const bool ok = (std::ferror(f_) == 0);
+  std::fclose(f_);
+  f_ = nullptr;
+  if (!ok) std::fprintf(stderr, "trace write failed: %s\n", path_.c_str());
+}
+
+void TracingPQ::reserve(std::size_t n) {
+  rec_(PQOp::Reserve, 0, (Cost32)n, 0);
+  q_.reserve(n);
+}
+
+void TracingPQ::clear() {
+  rec_(PQOp::Clear, 0, 0, 0);
+  q_.clear();
+}
+
+void TracingPQ::push(NodeId u, Key k) {
+  rec_(PQOp::Push, u, k.primary, k.tie);
+  q_.push(u, k);
+}
+
+void TracingPQ::decrease(NodeId u, Key k) {
+  rec_(PQOp::Decrease, u, k.primary, k.tie);
+  q_.decrease(u, k);
+}
+
+std::pair<NodeId, Key> TracingPQ::pop() {
+  auto r = q_.pop();
+  rec_(PQOp::Pop, r.first, r.second.primary, r.second.tie);
+  return r;
+}
+
+bool TracingPQ::contains(NodeId u) const {
+  const bool c = q_.contains(u);
+  rec_(PQOp::Contains, u, c ? 1u : 0u, 0);
+  return c;
+}
+
+PQTrace PQTrace::load(const std::string& path) {
+  std::FILE* f = std::fopen(path.c_str(), "rb");
+  if (!f) throw std::runtime_error("cannot open trace: " + path);
+  TraceHeader h{};
+  if (std::fread(&h, sizeof(h), 1, f) != 1 ||
+      std::memcmp(h.magic, kTraceMagic, sizeof(kTraceMagic)) != 0 ||
+      h.rec_size != sizeof(PQTraceRec)) {
+    std::fclose(f);
+    throw std::runtime_error("not a pq trace: " + path);
+  }
+  PQTrace T;
+  T.unordered = (h.flags & 1u) != 0;
+  T.recs.resize((std::size_t)h.count);
+  const std::size_t got = std::fread(T.recs.data(), sizeof(PQTraceRec), T.recs.size(), f);
+  std::fclose(f);
+  if (got != T.recs.size()) throw std::runtime_error("truncated pq trace: " + path);
+  return T;
+}
+
+uint32_t PQTrace::max_key_span() const {
+  Cost32 base = 0;
+  bool popped = false;   // 쿼리 첫 push(시작 노드)는 기준 키가 없음
+  uint32_t span = 1;
+  for (const auto& x : recs) {
+    const PQOp op = x.op();
+    if (op == PQOp::Clear) popped = false;
+    else if (op == PQOp::Pop) { base = x.cost; popped = true; }
+    else if ((op == PQOp::Push || op == PQOp::Decrease) && popped && x.cost > base)
+      span = std::max(span, x.cost - base);
+  }
+  return span;
+}
+
+bool PQTrace::monotone() const {
+  Cost32 base = 0;
+  for (const auto& x : recs) {
+    const PQOp op = x.op();
+    if (op == PQOp::Clear) base = 0;
+    else if (op == PQOp::Pop) base = std::max(base, x.cost);   // 비정렬 큐 기록이면 최대 pop 키 기준
+    else if ((op == PQOp::Push || op == PQOp::Decrease) && x.cost < base) return false;
+  }
+  return true;
+}
+
+PQReplayStats replay_trace(const PQTrace& T, IPQ& Q) {
+  using clock = std::chrono::steady_clock;
+  PQReplayStats st;
+  const PQTraceRec* r = T.recs.data();
+  const std::size_t n = T.recs.size();
+  volatile uint64_t sink = 0;   // 최적화로 pop/contains 가 사라지지 않게
+
+  const auto t0 = clock::now();
+  for (std::size_t i = 0; i < n; ++i) {
+    const PQTraceRec& x = r[i];
+    const PQOp op = x.op();
+    st.ops[(int)op]++;
+    switch (op) {
+      case PQOp::Reserve: Q.reserve(x.cost); break;
+      case PQOp::Clear:   Q.clear(); break;
+      case PQOp::Push:    Q.push(x.node(), x.key()); break;
+      case PQOp::Decrease: Q.decrease(x.node(), x.key()); break;
+      case PQOp::Pop: {
+        if (Q.empty()) { st.skipped++; break; }
+        const auto p = Q.pop();
+        sink += p.first;
+        st.pop_diff += (p.first != x.node());
+        break;
+      }
+      case PQOp::Contains: {
+        const NodeId u = x.node();
+        const bool c = Q.contains(u);
+        sink += c;
+        // 이어지는 push/decrease 를 재생 큐 상태에 맞춤
+        if (i + 1 < n && r[i + 1].node() == u &&
+            (r[i + 1].op() == PQOp::Push || r[i + 1].op() == PQOp::Decrease)) {
+          const PQTraceRec& y = r[++i];
+          st.ops[(int)y.op()]++;
+          st.diverged += (c != (x.cost != 0));
+          if (c) Q.decrease(u, y.key());
+          else   Q.push(u, y.key());
+        }
+        break;
+      }
+    }
+  }
+  st.ns = std::chrono::duration<double, std::nano>(clock::now() - t0).count();
+  return st;
+}
+
+} // namespace pathlab
@@ -0,0 +1,112 @@
+#include "pathlab/queues/radix_pq.hpp"
+#include <cassert>
+
+namespace pathlab {
+
+RadixPQ::RadixPQ(std::size_t n_hint) {
+  if (n_hint) reserve(n_hint);
+}
+
+void RadixPQ::reserve(std::size_t n) {
+  if (inq_.size() >= n) return;
+  inq_.resize(n, 0);
+  key_.resize(n, Key{Key::INF, 0});
+}
+
+void RadixPQ::clear() {
+  // 남은 엔트리만 훑어 inq_ 초기화: O(엔트리 수)
+  for (auto& b : buckets_) {
+    for (const Entry& e : b) inq_[e.u] = 0;
+    b.clear();
+  }
+  occupied_ = 0;
+  last_ = 0;
+  count_ = 0;
+  m_ = {};
+}
+
+void RadixPQ::insert_(NodeId u, Cost32 k) {
+  assert(k >= last_ && "RadixPQ requires monotone keys");
+  const int b = bucket_of_(k, last_);
+  buckets_[b].push_back({u, k});
+  occupied_ |= (uint64_t)1 << b;
+}
+
+void RadixPQ::push(NodeId u, Key k) {
+  if (u >= inq_.size()) reserve((std::size_t)u + 1);
+  if (inq_[u]) { decrease(u, k); return; }
+  inq_[u] = 1;
+  key_[u] = k;
+  insert_(u, k.primary);
+  count_++;
+  m_.pushes++;
+}
+
+void RadixPQ::decrease(NodeId u, Key k) {
+  if (!contains(u)) { push(u, k); return; }
+  if (k.primary >= key_[u].primary) return;   // 같은 primary 는 개선 아님
+  key_[u] = k;
+  insert_(u, k.primary);   // 옛 엔트리는 stale 로 남음
+  m_.decreases++;
+}
+
+bool RadixPQ::refill_() {
+  while (true) {
+    // bucket 0 앞쪽의 stale 은 꺼낼 때 폐기하므로 여기선 존재만 확인
+    auto& b0 = buckets_[0];
+    while (!b0.empty() && !live_(b0.back())) { b0.pop_back(); m_.moves++; }
+    if (!b0.empty()) return true;
+    occupied_ &= ~(uint64_t)1;
+    if (occupied_ == 0) return false;
+
+    // 가장 낮은 비어있지 않은 bucket
+    const int i = __builtin_ctzll(occupied_);
+    m_.scans++;
+    auto& bi = buckets_[i];
+
+    Cost32 mn = Key::INF;
+    for (const Entry& e : bi) if (live_(e) && e.k < mn) mn = e.k;
+    if (mn == Key::INF) {          // 전부 stale
+      m_.moves += bi.size();
+      bi.clear();
+      occupied_ &= ~((uint64_t)1 << i);
+      continue;
+    }
+
+    last_ = mn;
+    std::vector<Entry> tmp;
+    tmp.swap(bi);
+    occupied_ &= ~((uint64_t)1 << i);
+    for (const Entry& e : tmp) {
+      if (!live_(e)) { m_.moves++; continue; }
+      insert_(e.u, e.k);   // 항상 i 보다 낮은 bucket 으로 감
+      m_.moves++;
+    }
+    tmp.clear();
+    bi.swap(tmp);          // 용량 재사용
+  }
+}
+
+std::pair<NodeId, Key> RadixPQ::top() const {
+  auto* self = const_cast<RadixPQ*>(this);
+  if (!self->refill_()) return { 0u, Key{Key::INF, 0} };
+  const NodeId u = buckets_[0].back().u;
+  return { u, key_[u] };
+}
+
+std::pair<NodeId, Key> RadixPQ::pop() {
+  if (!refill_()) return { 0u, Key{Key::INF, 0} };
+  const NodeId u = buckets_[0].back().u;
+  buckets_[0].pop_back();
+  inq_[u] = 0;
+  count_--;
+  m_.pops++;
+  return { u, key_[u] };
+}
+
+std::optional<Key> RadixPQ::key_of(NodeId u) const {
+  if (!contains(u)) return std::nullopt;
+  return key_[u];
+}
+
+} // namespace pathlab
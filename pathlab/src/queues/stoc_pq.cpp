@@ -1,54 +1,80 @@
 #include "pathlab/queues/stoc_pq.hpp"
 #include <cassert>
+#include <algorithm>
 
 namespace pathlab {
 
-STOCPQ::STOCPQ(uint32_t block_size, Cost32 bound)
-  : B_(block_size ? block_size : 256),
+namespace {
+
+inline uint64_t packed(const Key& k) { return ((uint64_t)k.primary << 32) | k.tie; }
+
+} // namespace
+
+// 커널별 블록 크기: radix 는 패스당 고정비용(히스토그램)이 있어 큰 블록이 유리
+// (블록이 클수록 pop 순서도 정확해져 재확장이 줄어듦. 64 처럼 작으면 폭증)
+template <MetricsLevel L>
+uint32_t BasicSTOCPQ<L>::default_block_size(SortKernel kernel) {
+  switch (kernel) {
+    case SortKernel::Radix:   return 1024;
+    case SortKernel::Network: return 4 * kNetworkMax;
+    default:                  return 256;
+  }
+}
+
+template <MetricsLevel L>
+BasicSTOCPQ<L>::BasicSTOCPQ(uint32_t block_size, Cost32 bound, SortKernel kernel)
+  : B_(block_size ? block_size : default_block_size(kernel)),
+    kernel_(kernel),
     bound_(bound ? bound : Key::INF) {}
 
-void STOCPQ::reserve(std::size_t n) {
+template <MetricsLevel L>
+void BasicSTOCPQ<L>::reserve(std::size_t n) {
   ensure_best_size_(n);
 }
 
-void STOCPQ::clear() {
+template <MetricsLevel L>
+void BasicSTOCPQ<L>::clear() {
+  // best_ 가 설정된 노드는 반드시 남은 엔트리를 가짐 → 남은 엔트리만 훑어 초기화
+  for (const auto& blk : batch_blocks_)
+    for (const auto& it : blk) best_[it.first].reset();
+  for (const auto& blk : sorted_blocks_)
+    for (const auto& it : blk) best_[it.first].reset();
+  for (std::size_t i = active_pos_; i < active_.size(); ++i)
+    best_[active_[i].first].reset();
+
   batch_blocks_.clear();
   sorted_blocks_.clear();
   active_.clear();
   active_pos_ = 0;
-  best_.assign(best_.size(), std::nullopt);
   live_ = 0;
-  m_ = {};
+  mp_.reset();
 }
 
-bool STOCPQ::empty() const {
-  return live_ == 0 && active_pos_ >= active_.size()
-         && batch_blocks_.empty() && sorted_blocks_.empty();
-}
-
-std::size_t STOCPQ::size() const { return live_; }
-
-void STOCPQ::ensure_best_size_(std::size_t n) {
+template <MetricsLevel L>
+void BasicSTOCPQ<L>::ensure_best_size_(std::size_t n) {
   if (best_.size() <= n) best_.resize(n + 1);
 }
 
-void STOCPQ::append_unsorted_(Item it) {
+template <MetricsLevel L>
+void BasicSTOCPQ<L>::append_unsorted_(Item it) {
   if (sorted_blocks_.empty() || sorted_blocks_.back().size() >= B_) {
     sorted_blocks_.emplace_back();
     sorted_blocks_.back().reserve(B_);
-    m_.moves++; // 새 블록 할당으로 1회 이동 취급
+    mp_.move(); // 새 블록 할당으로 1회 이동 취급
   }
   sorted_blocks_.back().push_back(it);
-  m_.moves++; // append 1회
+  mp_.move(); // append 1회
 }
 
-void STOCPQ::prepend_batch_(std::vector<Item> blk) {
+template <MetricsLevel L>
+void BasicSTOCPQ<L>::prepend_batch_(std::vector<Item> blk) {
   if (blk.empty()) return;
   batch_blocks_.emplace_front(std::move(blk));
-  m_.moves++; // prepend 1회
+  mp_.move(); // prepend 1회
 }
 
-void STOCPQ::push(NodeId u, Key k) {
+template <MetricsLevel L>
+void BasicSTOCPQ<L>::push(NodeId u, Key k) {
   if (k.primary >= bound_) return;
   ensure_best_size_(u);
 
@@ -58,10 +84,11 @@ void STOCPQ::push(NodeId u, Key k) {
   best_[u] = k;
   append_unsorted_({u, k});
   live_++;
-  m_.pushes++;
+  mp_.push();
 }
 
-void STOCPQ::decrease(NodeId u, Key k) {
+template <MetricsLevel L>
+void BasicSTOCPQ<L>::decrease(NodeId u, Key k) {
   if (k.primary >= bound_) return;
   ensure_best_size_(u);
   auto& b = best_[u];
@@ -70,13 +97,55 @@ void STOCPQ::decrease(NodeId u, Key k) {
     b = k; // 최신 키로 갱신
     append_unsorted_({u, k}); // 지연: 구키는 나중에 폐기
     live_++;
-    m_.decreases++;
+    mp_.decrease();
   }
   // 더 크거나 같으면 무시
 }
 
+template <MetricsLevel L>
+bool BasicSTOCPQ<L>::accept_(NodeId u, Key k) {
+  if (k.primary >= bound_) return false;
+  ensure_best_size_(u);
+  auto& b = best_[u];
+  if (!b.has_value())          mp_.push();
+  else if (KeyLess{}(k, *b))   mp_.decrease();
+  else                         return false;
+  b = k;
+  live_++;
+  return true;
+}
+
+template <MetricsLevel L>
+bool BasicSTOCPQ<L>::push_or_decrease(NodeId u, Key k) {
+  if (!accept_(u, k)) return false;
+  append_unsorted_({u, k});
+  return true;
+}
+
+template <MetricsLevel L>
+void BasicSTOCPQ<L>::push_batch(const PQItem* items, std::size_t n) {
+  std::size_t i = 0;
+  while (i < n) {
+    if (sorted_blocks_.empty() || sorted_blocks_.back().size() >= B_) {
+      sorted_blocks_.emplace_back();
+      sorted_blocks_.back().reserve(B_);
+      mp_.move(); // 새 블록 할당으로 1회 이동 취급
+    }
+    auto& blk = sorted_blocks_.back();
+    const std::size_t room = B_ - blk.size();
+    std::size_t added = 0;
+    for (; i < n && added < room; ++i) {
+      if (!accept_(items[i].u, items[i].k)) continue;
+      blk.push_back({items[i].u, items[i].k});
+      added++;
+    }
+    mp_.move(added);
+  }
+}
+
 // active 블록 준비: batch 앞 → 없으면 sorted 뒤에서 꺼내 정렬
-bool STOCPQ::ensure_active_() {
+template <MetricsLevel L>
+bool BasicSTOCPQ<L>::ensure_active_() {
   if (active_pos_ < active_.size()) return true;
 
   active_.clear();
@@ -85,29 +154,138 @@ bool STOCPQ::ensure_active_() {
   if (!batch_blocks_.empty()) {
     active_ = std::move(batch_blocks_.front());
     batch_blocks_.pop_front();
-    m_.moves++; // 이동 1
+    mp_.move(); // 이동 1
   } else if (!sorted_blocks_.empty()) {
     active_ = std::move(sorted_blocks_.back());
     sorted_blocks_.pop_back();
-    m_.moves++; // 이동 1
+    mp_.move(); // 이동 1
   } else {
     return false; // 진짜 비었음
   }
 
-  // 정렬: 비교 1회당 scans++
-  std::sort(active_.begin(), active_.end(),
-            [this](const Item& a, const Item& b){
-              m_.scans++;
-              if (a.second.primary != b.second.primary) return a.second.primary < b.second.primary;
-              return a.second.tie < b.second.tie;
-            });
+  sort_active_();
   // moves: 대략 n-1 만큼(안정적/보수적 근사)
-  if (active_.size() > 1) m_.moves += (active_.size() - 1);
+  if (active_.size() > 1) mp_.move(active_.size() - 1);
   return true;
 }
 
+template <MetricsLevel L>
+void BasicSTOCPQ<L>::sort_active_() {
+  const std::size_t n = active_.size();
+  mp_.block_size(n);
+  if (n < 2) return;
+  switch (kernel_) {
+    case SortKernel::Radix:
+      sort_radix_();
+      return;
+    case SortKernel::Network:
+      sort_network_();
+      return;
+    default: {
+      std::sort(active_.begin(), active_.end(),
+                [](const Item& a, const Item& b){ return packed(a.second) < packed(b.second); });
+      // 비교 횟수 추정치 n*ceil(log2 n) (비교자 안에서 세지 않음)
+      uint64_t lg = 0;
+      while (((std::size_t)1 << lg) < n) ++lg;
+      mp_.scan((uint64_t)n * lg);
+      return;
+    }
+  }
+}
+
+// LSD radix: 8비트 digit × 8 패스. 히스토그램을 한 번에 만들고,
+// 모든 키가 같은 digit 을 가진 패스(상위 primary/tie 비트 등)는 건너뜀
+// scans += n × 실제 수행 패스
+template <MetricsLevel L>
+void BasicSTOCPQ<L>::sort_radix_() {
+  const std::size_t n = active_.size();
+  uint32_t hist[8][256] = {};
+  for (const Item& it : active_) {
+    const uint64_t k = packed(it.second);
+    for (int p = 0; p < 8; ++p) hist[p][(k >> (p * 8)) & 0xff]++;
+  }
+
+  scratch_.resize(n);
+  Item* src = active_.data();
+  Item* dst = scratch_.data();
+  for (int p = 0; p < 8; ++p) {
+    uint32_t* h = hist[p];
+    const uint64_t first = (packed(src[0].second) >> (p * 8)) & 0xff;
+    if (h[first] == n) continue;          // 이 digit 은 전부 같음
+
+    uint32_t sum = 0;
+    for (int b = 0; b < 256; ++b) { const uint32_t c = h[b]; h[b] = sum; sum += c; }
+    for (std::size_t i = 0; i < n; ++i) {
+      const uint64_t d = (packed(src[i].second) >> (p * 8)) & 0xff;
+      dst[h[d]++] = src[i];
+    }
+    std::swap(src, dst);
+    mp_.scan(n);
+  }
+  if (src != active_.data()) active_.swap(scratch_);
+}
+
+// kNetworkMax 단위 run 을 네트워크로 정렬한 뒤 bottom-up 병합
+// scans += 교환기 수 + 병합 단계마다 n
+template <MetricsLevel L>
+void BasicSTOCPQ<L>::sort_network_() {
+  const std::size_t n = active_.size();
+  Item* a = active_.data();
+  for (std::size_t b = 0; b < n; b += kNetworkMax)
+    mp_.scan(network_run_(a + b, std::min<std::size_t>(kNetworkMax, n - b)));
+
+  auto less = [](const Item& x, const Item& y){ return packed(x.second) < packed(y.second); };
+  scratch_.resize(n);
+  Item* src = active_.data();
+  Item* dst = scratch_.data();
+  for (std::size_t w = kNetworkMax; w < n; w <<= 1) {
+    for (std::size_t lo = 0; lo < n; lo += 2 * w) {
+      const std::size_t mid = std::min(n, lo + w), hi = std::min(n, lo + 2 * w);
+      std::merge(src + lo, src + mid, src + mid, src + hi, dst + lo, less);
+    }
+    std::swap(src, dst);
+    mp_.scan(n);
+  }
+  if (src != active_.data()) active_.swap(scratch_);
+}
+
+// bitonic 네트워크 (n <= kNetworkMax): 2의 거듭제곱으로 패딩 후 고정 순서
+// compare-exchange. 분기 없는 min/max 선택이라 데이터에 무관한 실행 경로
+template <MetricsLevel L>
+uint64_t BasicSTOCPQ<L>::network_run_(Item* a, std::size_t n) {
+  if (n < 2) return 0;
+  std::size_t P = 2;
+  while (P < n) P <<= 1;
+
+  uint64_t k[kNetworkMax];
+  NodeId   u[kNetworkMax];
+  for (std::size_t i = 0; i < n; ++i) { k[i] = packed(a[i].second); u[i] = a[i].first; }
+  for (std::size_t i = n; i < P; ++i) { k[i] = ~(uint64_t)0; u[i] = 0; }
+
+  uint64_t cx = 0;
+  for (std::size_t s = 2; s <= P; s <<= 1) {
+    for (std::size_t j = s >> 1; j > 0; j >>= 1) {
+      for (std::size_t i = 0; i < P; ++i) {
+        const std::size_t l = i ^ j;
+        if (l <= i) continue;
+        const bool up = (i & s) == 0;
+        const uint64_t a = k[i], b = k[l];
+        const NodeId  ua = u[i], ub = u[l];
+        const bool sw = up ? (a > b) : (a < b);
+        k[i] = sw ? b : a;  k[l] = sw ? a : b;
+        u[i] = sw ? ub : ua; u[l] = sw ? ua : ub;
+        ++cx;
+      }
+    }
+  }
+  for (std::size_t i = 0; i < n; ++i)
+    a[i] = Item{u[i], Key{(Cost32)(k[i] >> 32), (uint32_t)k[i]}};
+  return cx;
+}
+
 // active_pos_부터 stale(현재 best와 불일치) 폐기
-bool STOCPQ::skip_stale_forward_() {
+template <MetricsLevel L>
+bool BasicSTOCPQ<L>::skip_stale_forward_() {
   while (active_pos_ < active_.size()) {
     const auto& [u, k] = active_[active_pos_];
     if (u < best_.size() && best_[u].has_value()
@@ -116,14 +294,16 @@ bool STOCPQ::skip_stale_forward_() {
       return true;
     }
     // stale → 폐기
+    mp_.stale_pop();
     active_pos_++;
     if (live_ > 0) live_--;
-    m_.moves++; // discard 1회
+    mp_.move(); // discard 1회
   }
   return false;
 }
 
-std::pair<NodeId, Key> STOCPQ::peek_impl_() {
+template <MetricsLevel L>
+std::pair<NodeId, Key> BasicSTOCPQ<L>::peek_impl_() {
   while (true) {
     if (!ensure_active_()) break;
     if (skip_stale_forward_()) {
@@ -135,7 +315,8 @@ std::pair<NodeId, Key> STOCPQ::peek_impl_() {
   return {0u, Key{Key::INF, 0}};
 }
 
-std::pair<NodeId, Key> STOCPQ::pop_impl_() {
+template <MetricsLevel L>
+std::pair<NodeId, Key> BasicSTOCPQ<L>::pop_impl_() {
   while (true) {
     if (!ensure_active_()) break;
     if (skip_stale_forward_()) {
@@ -145,30 +326,33 @@ std::pair<NodeId, Key> STOCPQ::pop_impl_() {
       if (live_ > 0) live_--;
       // 이 시점에서 u는 PQ에서 제거되므로 best를 비워 contains=false가 됨
       best_[u].reset();
-      m_.pops++;
-      m_.moves++; // consume 1회
+      mp_.pop();
+      mp_.move(); // consume 1회
       return {u, k};
     }
   }
   return {0u, Key{Key::INF, 0}};
 }
 
-std::pair<NodeId, Key> STOCPQ::top() const {
+template <MetricsLevel L>
+std::pair<NodeId, Key> BasicSTOCPQ<L>::top() const {
   // const 인터페이스 요구로 내부 비-const 헬퍼 호출
-  return const_cast<STOCPQ*>(this)->peek_impl_();
+  return const_cast<BasicSTOCPQ*>(this)->peek_impl_();
 }
 
-std::pair<NodeId, Key> STOCPQ::pop() {
+template <MetricsLevel L>
+std::pair<NodeId, Key> BasicSTOCPQ<L>::pop() {
   return pop_impl_();
 }
 
-bool STOCPQ::contains(NodeId u) const {
-  return (u < best_.size()) && best_[u].has_value();
-}
-
-std::optional<Key> STOCPQ::key_of(NodeId u) const {
+template <MetricsLevel L>
+std::optional<Key> BasicSTOCPQ<L>::key_of(NodeId u) const {
   if (!contains(u)) return std::nullopt;
   return best_[u];
 }
 
+template class BasicSTOCPQ<MetricsLevel::Off>;
+template class BasicSTOCPQ<MetricsLevel::Counters>;
+template class BasicSTOCPQ<MetricsLevel::Detailed>;
+
 } // namespace pathlab
@@ -0,0 +1,118 @@
+#include "pathlab/server/protocol.hpp"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace pathlab {
+
+bool read_full(int fd, void* buf, std::size_t n) {
+  auto* p = static_cast<uint8_t*>(buf);
+  while (n > 0) {
+    const ssize_t r = ::read(fd, p, n);
+    if (r < 0 && errno == EINTR) continue;
+    if (r <= 0) return false;
+    p += r; n -= (std::size_t)r;
+  }
+  return true;
+}
+
+bool write_full(int fd, const void* buf, std::size_t n) {
+  const auto* p = static_cast<const uint8_t*>(buf);
+  while (n > 0) {
+    const ssize_t r = ::write(fd, p, n);
+    if (r < 0 && errno == EINTR) continue;
+    if (r <= 0) return false;
+    p += r; n -= (std::size_t)r;
+  }
+  return true;
+}
+
+bool read_frame(int fd, FrameHeader& h, std::vector<uint8_t>& payload) {
+  if (!read_full(fd, &h, sizeof(h))) return false;
+  if (h.magic != kFrameMagic || h.len > kMaxFrameLen) return false;
+  payload.resize(h.len);
+  return h.len == 0 || read_full(fd, payload.data(), h.len);
+}
+
+bool write_frame(int fd, MsgType type, uint32_t req_id, const void* payload, std::size_t len,
+                 uint16_t flags) {
+  if (len > kMaxFrameLen) return false;
+  FrameHeader h{kFrameMagic, (uint32_t)len, (uint16_t)type, flags, req_id};
+  iovec iov[2] = {{&h, sizeof(h)}, {const_cast<void*>(payload), len}};
+  std::size_t total = sizeof(h) + len;
+  ssize_t r;
+  do { r = ::writev(fd, iov, len ? 2 : 1); } while (r < 0 && errno == EINTR);
+  if (r < 0) return false;
+  if ((std::size_t)r == total) return true;
+  // 부분 전송: 나머지는 순차 write
+  std::size_t done = (std::size_t)r;
+  if (done < sizeof(h)) {
+    if (!write_full(fd, reinterpret_cast<const uint8_t*>(&h) + done, sizeof(h) - done)) return false;
+    done = sizeof(h);
+  }
+  return write_full(fd, static_cast<const uint8_t*>(payload) + (done - sizeof(h)), total - done);
+}
+
+namespace {
+
+sockaddr_un make_addr(const std::string& path) {
+  sockaddr_un a{};
+  a.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(a.sun_path)) throw std::runtime_error("socket path too long: " + path);
+  std::memcpy(a.sun_path, path.c_str(), path.size() + 1);
+  return a;
+}
+
+} // namespace
+
+int unix_listen(const std::string& path, int backlog) {
+  const sockaddr_un a = make_addr(path);
+  const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) throw std::runtime_error("socket() failed");
+  // 이전 실행이 남긴 소켓 파일만 지움
+  // - 일반 파일 등: 경로를 잘못 준 것 → 지우지 않음
+  // - connect 가 되면 살아 있는 서버가 쓰는 중 → 경로를 빼앗지 않음
+  // - ECONNREFUSED 면 듣는 프로세스가 없는 잔해
+  struct stat st;
+  if (::lstat(path.c_str(), &st) == 0) {
+    std::string why;
+    if (!S_ISSOCK(st.st_mode)) {
+      why = "exists and is not a socket";
+    } else {
+      const int probe = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+      const int r = probe < 0 ? -1 : ::connect(probe, reinterpret_cast<const sockaddr*>(&a), sizeof(a));
+      const int err = errno;
+      if (probe >= 0) ::close(probe);
+      if (r == 0)                  why = "already in use by a running server";
+      else if (err != ECONNREFUSED) why = std::string("cannot probe existing socket: ") + std::strerror(err);
+      else                         ::unlink(path.c_str());
+    }
+    if (!why.empty()) {
+      ::close(fd);
+      throw std::runtime_error("cannot listen on " + path + ": " + why);
+    }
+  }
+  if (::bind(fd, reinterpret_cast<const sockaddr*>(&a), sizeof(a)) != 0 || ::listen(fd, backlog) != 0) {
+    ::close(fd);
+    throw std::runtime_error("cannot listen on " + path + ": " + std::strerror(errno));
+  }
+  return fd;
+}
+
+int unix_connect(const std::string& path) {
+  const sockaddr_un a = make_addr(path);
+  const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) throw std::runtime_error("socket() failed");
+  if (::connect(fd, reinterpret_cast<const sockaddr*>(&a), sizeof(a)) != 0) {
+    ::close(fd);
+    throw std::runtime_error("cannot connect to " + path + ": " + std::strerror(errno));
+  }
+  return fd;
+}
+
+} // namespace pathlab
@@ -0,0 +1,74 @@
+#include "pathlab/util/metrics_policy.hpp"
+#include <algorithm>
+
+namespace pathlab {
+
+const char* metrics_level_name(MetricsLevel l) {
+  switch (l) {
+    case MetricsLevel::Off:      return "off";
+    case MetricsLevel::Counters: return "counters";
+    case MetricsLevel::Detailed: return "detailed";
+  }
+  return "?";
+}
+
+bool parse_metrics_level(const std::string& s, MetricsLevel& out) {
+  if      (s == "off")      out = MetricsLevel::Off;
+  else if (s == "counters") out = MetricsLevel::Counters;
+  else if (s == "detailed") out = MetricsLevel::Detailed;
+  else return false;
+  return true;
+}
+
+uint64_t Histogram::percentile(double q) const {
+  if (count == 0) return 0;
+  const uint64_t want = std::max<uint64_t>(1, (uint64_t)(q * (double)count + 0.5));
+  uint64_t acc = 0;
+  for (int b = 0; b < kBins; ++b) {
+    acc += bin[b];
+    if (acc >= want) return bin_lo(b);
+  }
+  return max;
+}
+
+Histogram& Histogram::operator+=(const Histogram& o) {
+  for (int b = 0; b < kBins; ++b) bin[b] += o.bin[b];
+  count += o.count;
+  sum   += o.sum;
+  max    = std::max(max, o.max);
+  return *this;
+}
+
+PQHistograms& PQHistograms::operator+=(const PQHistograms& o) {
+  sift_levels += o.sift_levels;
+  bucket_size += o.bucket_size;
+  block_size  += o.block_size;
+  stale_pops  += o.stale_pops;
+  return *this;
+}
+
+AlgoHistograms& AlgoHistograms::operator+=(const AlgoHistograms& o) {
+  improved_per_expansion += o.improved_per_expansion;
+  frontier   += o.frontier;
+  stale_pops += o.stale_pops;
+  reexpanded += o.reexpanded;
+  return *this;
+}
+
+void AlgoMetricsPolicy<MetricsLevel::Detailed>::begin(std::size_t n) {
+  if (!h) return;
+  if (h->seen.size() < n) h->seen.resize(n, 0);
+  if (++h->gen == 0) { std::fill(h->seen.begin(), h->seen.end(), 0u); h->gen = 1; }
+}
+
+// stale pop 은 재확장으로 세지 않음 (이미 확장한 노드의 구 엔트리일 뿐)
+void AlgoMetricsPolicy<MetricsLevel::Detailed>::observe_pop(NodeId u, Cost32 key, Cost32 dist,
+                                                            std::size_t qsize) {
+  if (!h) return;
+  h->frontier.add(qsize);
+  if (key > dist) { h->stale_pops++; return; }
+  if (h->seen[u] == h->gen) h->reexpanded++;
+  else                      h->seen[u] = h->gen;
+}
+
+} // namespace pathlab
@@ -0,0 +1,178 @@
+#include "pathlab/util/perf_counters.hpp"
+
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace pathlab {
+
+const char* hw_event_name(HwEvent e) {
+  switch (e) {
+    case HwEvent::Cycles:       return "cycles";
+    case HwEvent::Instructions: return "instr";
+    case HwEvent::L1DMiss:      return "l1d_miss";
+    case HwEvent::LLCMiss:      return "llc_miss";
+    case HwEvent::BranchMiss:   return "br_miss";
+  }
+  return "?";
+}
+
+#if defined(__linux__)
+
+namespace {
+
+// group_fd < 0 이면 단독 이벤트 (시작 시 disabled), 아니면 그 리더의 그룹 멤버
+// (멤버는 리더를 따라 켜지고 꺼지므로 disabled=0)
+int open_event(uint32_t type, uint64_t config, int group_fd, uint64_t read_format) {
+  perf_event_attr a;
+  std::memset(&a, 0, sizeof(a));
+  a.size = sizeof(a);
+  a.type = type;
+  a.config = config;
+  a.disabled = (group_fd < 0) ? 1 : 0;
+  a.exclude_kernel = 1;
+  a.exclude_hv = 1;
+  a.read_format = read_format;
+  return (int)::syscall(SYS_perf_event_open, &a, 0 /*this thread*/, -1, group_fd, 0);
+}
+
+constexpr uint64_t kSingleFormat = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+constexpr uint64_t kGroupFormat  = PERF_FORMAT_GROUP | kSingleFormat;
+
+struct EventSpec { uint32_t type; uint64_t config; };
+
+EventSpec event_spec(int i) {
+  const uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D
+                               | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                               | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+  switch ((HwEvent)i) {
+    case HwEvent::Cycles:       return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES};
+    case HwEvent::Instructions: return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS};
+    case HwEvent::L1DMiss:      return {PERF_TYPE_HW_CACHE, l1d_read_miss};
+    case HwEvent::LLCMiss:      return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES};
+    case HwEvent::BranchMiss:   return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES};
+  }
+  return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES};
+}
+
+inline uint64_t scaled(uint64_t v, uint64_t enabled, uint64_t running) {
+  return (running < enabled) ? (uint64_t)((double)v * (double)enabled / (double)running) : v;
+}
+
+} // namespace
+
+PerfCounters::PerfCounters() {
+  for (int i = 0; i < kNumHwEvents; ++i) fd_[i] = -1;
+  if (!open_group_()) open_single_();
+}
+
+PerfCounters::~PerfCounters() { close_all_(); }
+
+void PerfCounters::close_all_() {
+  // 멤버를 먼저 닫고 리더(cycles)를 마지막에
+  for (int i = kNumHwEvents - 1; i >= 0; --i)
+    if (fd_[i] >= 0) { ::close(fd_[i]); fd_[i] = -1; }
+  opened_ = 0;
+  n_group_ = 0;
+  grouped_ = false;
+}
+
+// cycles 를 리더로 한 그룹: 모든 이벤트가 같은 구간을 세고 멀티플렉싱도 함께 됨
+// 리더가 안 열리거나, 시험 측정에서 PMU 가 그룹을 한 번도 올리지 못하면 false
+bool PerfCounters::open_group_() {
+  const int lead = (int)HwEvent::Cycles;
+  const EventSpec ls = event_spec(lead);
+  fd_[lead] = open_event(ls.type, ls.config, -1, kGroupFormat);
+  if (fd_[lead] < 0) return false;
+  order_[n_group_++] = lead;
+  for (int i = 0; i < kNumHwEvents; ++i) {
+    if (i == lead) continue;
+    const EventSpec es = event_spec(i);
+    fd_[i] = open_event(es.type, es.config, fd_[lead], kGroupFormat);
+    if (fd_[i] >= 0) order_[n_group_++] = i;
+  }
+  grouped_ = true;
+  opened_ = n_group_;
+
+  start();
+  volatile uint64_t sink = 0;
+  for (uint32_t i = 0; i < 100000; ++i) sink = sink + i;
+  const HwCounts probe = stop();
+  if (!probe.has(HwEvent::Cycles)) { close_all_(); return false; }
+  return true;
+}
+
+void PerfCounters::open_single_() {
+  for (int i = 0; i < kNumHwEvents; ++i) {
+    const EventSpec es = event_spec(i);
+    fd_[i] = open_event(es.type, es.config, -1, kSingleFormat);
+    if (fd_[i] >= 0) ++opened_;
+  }
+}
+
+void PerfCounters::start() {
+  if (grouped_) {
+    const int lead = fd_[(int)HwEvent::Cycles];
+    ::ioctl(lead, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ::ioctl(lead, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return;
+  }
+  for (int i = 0; i < kNumHwEvents; ++i) {
+    if (fd_[i] < 0) continue;
+    ::ioctl(fd_[i], PERF_EVENT_IOC_RESET, 0);
+    ::ioctl(fd_[i], PERF_EVENT_IOC_ENABLE, 0);
+  }
+}
+
+HwCounts PerfCounters::stop() {
+  HwCounts c;
+  if (grouped_) {
+    const int lead = fd_[(int)HwEvent::Cycles];
+    ::ioctl(lead, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    uint64_t buf[3 + kNumHwEvents] = {};   // nr, time_enabled, time_running, value[nr]
+    const ssize_t want = (ssize_t)((3 + n_group_) * sizeof(uint64_t));
+    if (::read(lead, buf, sizeof(buf)) != want || buf[0] != (uint64_t)n_group_) return c;
+    if (buf[2] == 0) {   // 한 번도 스케줄되지 않음
+      for (int j = 0; j < n_group_; ++j) c.ok[order_[j]] = (buf[1] == 0);
+      return c;
+    }
+    // 그룹 전체가 같은 비율로 보정되므로 IPC 같은 비율이 유지됨
+    for (int j = 0; j < n_group_; ++j) {
+      c.v[order_[j]] = scaled(buf[3 + j], buf[1], buf[2]);
+      c.ok[order_[j]] = true;
+    }
+    return c;
+  }
+
+  for (int i = 0; i < kNumHwEvents; ++i)
+    if (fd_[i] >= 0) ::ioctl(fd_[i], PERF_EVENT_IOC_DISABLE, 0);
+  for (int i = 0; i < kNumHwEvents; ++i) {
+    if (fd_[i] < 0) continue;
+    uint64_t buf[3] = {};   // value, time_enabled, time_running
+    if (::read(fd_[i], buf, sizeof(buf)) != (ssize_t)sizeof(buf)) continue;
+    if (buf[2] == 0) { c.ok[i] = (buf[1] == 0); continue; }   // 한 번도 스케줄되지 않음
+    c.v[i] = scaled(buf[0], buf[1], buf[2]);
+    c.ok[i] = true;
+  }
+  return c;
+}
+
+#else
+
+PerfCounters::PerfCounters() {
+  for (int i = 0; i < kNumHwEvents; ++i) fd_[i] = -1;
+}
+PerfCounters::~PerfCounters() = default;
+void PerfCounters::close_all_() {}
+bool PerfCounters::open_group_() { return false; }
+void PerfCounters::open_single_() {}
+void PerfCounters::start() {}
+HwCounts PerfCounters::stop() { return {}; }
+
+#endif
+
+} // namespace pathlab